@@ -0,0 +1,68 @@
+#ifndef CPPURSES_BENCH_EVENT_HELPERS_HPP
+#define CPPURSES_BENCH_EVENT_HELPERS_HPP
+#include <memory>
+
+#include <cppurses/system/detail/event_engine.hpp>
+#include <cppurses/system/detail/event_queue.hpp>
+#include <cppurses/system/event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/terminal/headless_screen.hpp>
+#include <cppurses/widget/area.hpp>
+
+namespace bench {
+
+/// Throw away the queued Paint events, nothing is painted in benchmarks.
+inline void discard_paints() {
+    using namespace cppurses;
+    auto& queue = detail::Event_engine::get().queue();
+    for (std::unique_ptr<Event> event :
+         detail::Event_queue::View<Event::Paint>{queue}) {
+        event.reset();
+    }
+    queue.clean();
+}
+
+/// Throw away every queued event without sending it.
+inline void discard_events() {
+    using namespace cppurses;
+    auto& queue = detail::Event_engine::get().queue();
+    for (std::unique_ptr<Event> event :
+         detail::Event_queue::View<Event::None>{queue}) {
+        event.reset();
+    }
+    queue.clean();
+    discard_paints();
+}
+
+/// Send every queued event, and those they post, then drop the Paints.
+inline void process_events() {
+    using namespace cppurses;
+    auto& queue = detail::Event_engine::get().queue();
+    for (std::unique_ptr<Event> event :
+         detail::Event_queue::View<Event::None>{queue}) {
+        System::send_event(*event);
+    }
+    queue.clean();
+    discard_paints();
+}
+
+/// Installs a Headless_screen as the terminal for the scope's lifetime.
+/** Keeps results independent of the terminal the benchmarks run in. */
+class Headless_terminal {
+   public:
+    explicit Headless_terminal(cppurses::Area size) : screen_{size} {
+        cppurses::System::terminal.use_headless(&screen_);
+        cppurses::System::terminal.initialize();
+    }
+
+    ~Headless_terminal() {
+        cppurses::System::terminal.uninitialize();
+        cppurses::System::terminal.use_headless(nullptr);
+    }
+
+   private:
+    cppurses::Headless_screen screen_;
+};
+
+}  // namespace bench
+#endif  // CPPURSES_BENCH_EVENT_HELPERS_HPP
@@ -0,0 +1,134 @@
+#include <cstddef>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/layout_batch.hpp>
+#include <cppurses/widget/layouts/grid.hpp>
+#include <cppurses/widget/layouts/horizontal.hpp>
+#include <cppurses/widget/layouts/vertical.hpp>
+#include <cppurses/widget/widget.hpp>
+
+#include "event_helpers.hpp"
+
+using namespace cppurses;
+using bench::discard_events;
+using bench::process_events;
+
+namespace {
+
+/// Vertical layout with \p count children, cycling through the Size_policies.
+class Column : public layout::Vertical {
+   public:
+    explicit Column(std::size_t count) {
+        for (std::size_t i{0}; i < count; ++i) {
+            auto& child = this->make_child<Widget>();
+            auto& policy = child.height_policy;
+            switch (i % 5) {
+                case 0:
+                    policy.expanding(1);
+                    policy.max_size(4);
+                    break;
+                case 1:
+                    policy.preferred(3);
+                    policy.min_size(1);
+                    break;
+                case 2:
+                    policy.minimum(1);
+                    break;
+                case 3:
+                    policy.maximum(4);
+                    break;
+                default:
+                    policy.minimumExpanding(2);
+                    break;
+            }
+            policy.stretch(1 + i % 3);
+        }
+        this->enable();
+    }
+};
+
+/// Lay out 1k children, alternating the height so each pass has work to do.
+/** state.range(0) is the height in the first pass, the second is one more. */
+void layout_vertical_1k_children(benchmark::State& state) {
+    discard_events();
+    Column column{1000};
+    const auto height = static_cast<std::size_t>(state.range(0));
+    auto extra = std::size_t{0};
+    for (auto _ : state) {
+        System::send_event(Resize_event{column, Area{80, height + extra}});
+        extra = 1 - extra;
+        discard_events();
+    }
+}
+// Shrinking below the size hints, and growing into spare space.
+BENCHMARK(layout_vertical_1k_children)->Arg(1500)->Arg(4000);
+
+/// Make five Size_policy changes to each of 1k children, then process them.
+/** state.range(0) is 1 if the changes are made within a Layout_batch. */
+void configure_1k_children(benchmark::State& state) {
+    discard_events();
+    Column column{1000};
+    System::send_event(Resize_event{column, Area{80, 4000}});
+    process_events();
+    const bool batched = state.range(0) == 1;
+    auto hint = std::size_t{1};
+    for (auto _ : state) {
+        {
+            std::unique_ptr<Layout_batch> batch;
+            if (batched) {
+                batch = std::make_unique<Layout_batch>(column);
+            }
+            for (const std::unique_ptr<Widget>& child : column.children.get()) {
+                auto& policy = child->height_policy;
+                policy.preferred(hint);
+                policy.min_size(1);
+                policy.max_size(hint + 2);
+                policy.stretch(hint);
+                policy.hint(hint + 1);
+            }
+        }
+        process_events();
+        hint = 3 - hint;
+    }
+}
+BENCHMARK(configure_1k_children)->Arg(0)->Arg(1);
+
+/// Resize a 20x20 dashboard of Widgets, send every Event it causes.
+/** state.range(0) is 1 for a Grid, 0 for a Vertical of 20 Horizontals. */
+void layout_dashboard_20x20(benchmark::State& state) {
+    discard_events();
+    std::unique_ptr<layout::Layout> dashboard;
+    if (state.range(0) == 1) {
+        auto grid = std::make_unique<layout::Grid>(20);
+        for (int i{0}; i < 400; ++i) {
+            grid->make_child<Widget>();
+        }
+        dashboard = std::move(grid);
+    } else {
+        auto rows = std::make_unique<layout::Vertical>();
+        for (int i{0}; i < 20; ++i) {
+            auto& row = rows->make_child<layout::Horizontal>();
+            for (int j{0}; j < 20; ++j) {
+                row.make_child<Widget>();
+            }
+        }
+        dashboard = std::move(rows);
+    }
+    dashboard->enable();
+    process_events();
+    auto extra = std::size_t{0};
+    for (auto _ : state) {
+        System::send_event(
+            Resize_event{*dashboard, Area{200 + extra, 100 + extra}});
+        process_events();
+        extra = 1 - extra;
+    }
+}
+BENCHMARK(layout_dashboard_20x20)->Arg(0)->Arg(1);
+
+}  // namespace
@@ -0,0 +1,57 @@
+#include <cstddef>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/widgets/log.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+/// Log holding at most \p max_messages messages, enabled and sized to 80x24.
+class Bounded_log : public Log {
+   public:
+    explicit Bounded_log(std::size_t max_messages) {
+        this->set_max_messages(max_messages);
+        this->enable();
+        System::send_event(Resize_event{*this, Area{80, 24}});
+    }
+};
+
+/// Post messages to a full Log, so each post also evicts the oldest message.
+void log_post_message_at_capacity(benchmark::State& state) {
+    const auto capacity = static_cast<std::size_t>(state.range(0));
+    Bounded_log log{capacity};
+    const auto message =
+        Glyph_string{"[info] frame rendered in 16ms, 1920 cells changed"};
+    for (auto i = std::size_t{0}; i < capacity; ++i) {
+        log.post_message(message);
+    }
+    for (auto _ : state) {
+        log.post_message(message);
+    }
+}
+BENCHMARK(log_post_message_at_capacity)->Arg(1000)->Arg(100000);
+
+/// Queue a frame's worth of messages, then append them in one flush.
+void log_flush_async_messages(benchmark::State& state) {
+    const auto batch = static_cast<int>(state.range(0));
+    Bounded_log log{100000};
+    const auto message =
+        Glyph_string{"[info] frame rendered in 16ms, 1920 cells changed"};
+    for (auto _ : state) {
+        for (auto i = 0; i < batch; ++i) {
+            log.post_message_async(message, "renderer");
+        }
+        log.flush_async_messages();
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(log_flush_async_messages)->Arg(1)->Arg(100);
+
+}  // namespace
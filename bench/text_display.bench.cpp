@@ -0,0 +1,182 @@
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/color.hpp>
+#include <cppurses/painter/detail/staged_changes.hpp>
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/system/events/paint_event.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/widgets/highlighter.hpp>
+#include <cppurses/widget/widgets/text_display.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+/// Return roughly \p size characters of words, with a newline every ~70.
+auto make_document(std::size_t size) -> std::string {
+    const char* const words[] = {"the",   "quick", "brown",   "fox", "jumps",
+                                 "over",  "a",     "lazy",    "dog", "while",
+                                 "event", "loops", "repaint", "it"};
+    auto gen = std::mt19937{42};
+    auto pick = std::uniform_int_distribution<std::size_t>{0, 13};
+    auto text = std::string{};
+    text.reserve(size + 16);
+    auto line_length = std::size_t{0};
+    while (text.size() < size) {
+        const auto word = std::string{words[pick(gen)]};
+        text.append(word);
+        line_length += word.size() + 1;
+        if (line_length > 70) {
+            text.push_back('\n');
+            line_length = 0;
+        } else {
+            text.push_back(' ');
+        }
+    }
+    return text;
+}
+
+/// Text_display with the given contents, enabled and sized to 80x24.
+class Document : public Text_display {
+   public:
+    explicit Document(std::size_t size)
+        : Text_display{Glyph_string{make_document(size)}} {
+        this->enable();
+        System::send_event(Resize_event{*this, Area{80, 24}});
+    }
+
+    /// Scroll down until the line holding \p index is at the top.
+    void scroll_to(std::size_t index) {
+        this->scroll_down(this->line_at(index) - this->top_line());
+    }
+};
+
+/// Type, then delete, a character at the end of the document.
+void text_display_type_at_end(benchmark::State& state) {
+    Document doc{static_cast<std::size_t>(state.range(0))};
+    // The first append reallocates the whole buffer, keep it out of timing.
+    doc.append(Glyph_string{"x"});
+    doc.pop_back();
+    for (auto _ : state) {
+        doc.append(Glyph_string{"x"});
+        doc.pop_back();
+    }
+}
+BENCHMARK(text_display_type_at_end)->Arg(1 << 20)->Arg(10 << 20);
+
+/// Type, then delete, a character in the middle of the document.
+void text_display_type_in_middle(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    Document doc{size};
+    const auto index = size / 2;
+    for (auto _ : state) {
+        doc.insert(Glyph_string{"x"}, index);
+        doc.erase(index, 1);
+    }
+}
+BENCHMARK(text_display_type_in_middle)->Arg(1 << 20)->Arg(10 << 20);
+
+/// Find the screen position of random indices, as placing the cursor does.
+void text_display_display_position(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    Document doc{size};
+    auto gen = std::mt19937{7};
+    auto pick = std::uniform_int_distribution<std::size_t>{0, size - 1};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(doc.display_position(pick(gen)));
+    }
+}
+BENCHMARK(text_display_display_position)->Arg(1 << 20)->Arg(10 << 20);
+
+/// Find every occurrence of a word in the document.
+void text_display_find(benchmark::State& state) {
+    Document doc{static_cast<std::size_t>(state.range(0))};
+    const auto patterns = {Glyph_string{"repaint"}, Glyph_string{"lazy dog"}};
+    for (auto _ : state) {
+        for (const auto& pattern : patterns) {
+            doc.find(pattern);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(text_display_find)->Arg(1 << 20)->Arg(10 << 20);
+
+/// Type in the middle of the document while a search is active.
+void text_display_type_while_searching(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    Document doc{size};
+    doc.find(Glyph_string{"the"});
+    const auto index = size / 2;
+    for (auto _ : state) {
+        doc.insert(Glyph_string{"the"}, index);
+        doc.erase(index, 3);
+    }
+}
+BENCHMARK(text_display_type_while_searching)->Arg(1 << 20)->Arg(10 << 20);
+
+/// Paint a screen of the document, as each frame does.
+void text_display_paint(benchmark::State& state) {
+    Document doc{static_cast<std::size_t>(state.range(0))};
+    doc.scroll_down(1000);
+    for (auto _ : state) {
+        System::send_event(Paint_event{doc});
+        detail::Staged_changes::get().clear();
+    }
+}
+BENCHMARK(text_display_paint)->Arg(1 << 20);
+
+/// Colors "the", and everything from "while" to the next "it".
+class Keyword_highlighter : public Highlighter {
+   public:
+    State highlight(const std::wstring& line,
+                    State state,
+                    std::vector<Span>& spans) const override {
+        for (auto i = std::size_t{0}; i < line.size(); ++i) {
+            if (state == 0 && line.compare(i, 5, L"while") == 0) {
+                state = 1;
+            } else if (state == 1 && line.compare(i, 2, L"it") == 0) {
+                state = 0;
+            } else if (line.compare(i, 3, L"the") == 0) {
+                spans.push_back(Span{i, 3, keyword});
+                i += 2;
+                continue;
+            }
+            if (state == 1) {
+                spans.push_back(Span{i, 1, quoted});
+            }
+        }
+        return state;
+    }
+
+   private:
+    const Brush keyword{foreground(Color::Blue)};
+    const Brush quoted{foreground(Color::Green)};
+};
+
+/// Type in the middle of a highlighted document and repaint it each time.
+void text_display_type_highlighted(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    Document doc{size};
+    doc.set_highlighter(std::make_unique<Keyword_highlighter>());
+    const auto index = size / 2;
+    doc.scroll_to(index);
+    for (auto _ : state) {
+        doc.insert(Glyph_string{"x"}, index);
+        System::send_event(Paint_event{doc});
+        doc.erase(index, 1);
+        System::send_event(Paint_event{doc});
+        detail::Staged_changes::get().clear();
+    }
+}
+BENCHMARK(text_display_type_highlighted)->Arg(1 << 20)->Arg(10 << 20);
+
+}  // namespace
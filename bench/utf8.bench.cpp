@@ -0,0 +1,73 @@
+#include <codecvt>
+#include <cstddef>
+#include <locale>
+#include <random>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/painter/utility/utf8.hpp>
+#include <cppurses/painter/utility/wchar_to_bytes.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+/// Return \p size wchar_ts, one in \p one_in of them outside of ASCII.
+auto make_text(std::size_t size, int one_in) -> std::wstring {
+    auto gen = std::mt19937{11};
+    auto pick = std::uniform_int_distribution<int>{0, one_in - 1};
+    auto text = std::wstring{};
+    for (auto i = std::size_t{0}; i < size; ++i) {
+        text.push_back(pick(gen) == 0 ? L'─' : L'a' + i % 26);
+    }
+    return text;
+}
+
+constexpr auto text_size = std::size_t{1} << 20;
+
+/// Decode UTF-8, argument is the chance of a non-ASCII character.
+void utf8_decode(benchmark::State& state) {
+    const auto bytes =
+        utility::wchar_to_bytes(make_text(text_size, state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(utility::bytes_to_wchar(bytes));
+    }
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+BENCHMARK(utf8_decode)->Arg(1000000)->Arg(100)->Arg(2);
+
+/// Encode to UTF-8, argument is the chance of a non-ASCII character.
+void utf8_encode(benchmark::State& state) {
+    const auto text = make_text(text_size, state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(utility::wchar_to_bytes(text));
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(utf8_encode)->Arg(1000000)->Arg(100)->Arg(2);
+
+/// The std::wstring_convert decoder previously used, for comparison.
+void utf8_decode_wstring_convert(benchmark::State& state) {
+    const auto bytes =
+        utility::wchar_to_bytes(make_text(text_size, state.range(0)));
+    for (auto _ : state) {
+        std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
+        benchmark::DoNotOptimize(converter.from_bytes(bytes));
+    }
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+BENCHMARK(utf8_decode_wstring_convert)->Arg(1000000)->Arg(100)->Arg(2);
+
+/// Build a Glyph_string from UTF-8, as labels and Log messages do.
+void utf8_glyph_string(benchmark::State& state) {
+    const auto bytes = utility::wchar_to_bytes(make_text(text_size, 100));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Glyph_string{bytes});
+    }
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+BENCHMARK(utf8_glyph_string);
+
+}  // namespace
@@ -0,0 +1,167 @@
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <cppurses/system/detail/find_widget_at.hpp>
+#include <cppurses/system/events/child_event.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/focus.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/focus_policy.hpp>
+#include <cppurses/widget/layouts/horizontal.hpp>
+#include <cppurses/widget/layouts/vertical.hpp>
+#include <cppurses/widget/widget.hpp>
+
+#include "event_helpers.hpp"
+
+using namespace cppurses;
+
+namespace {
+
+/// Vertical of \p rows Horizontals, each holding \p columns Widgets.
+class Board : public layout::Vertical {
+   public:
+    Board(std::size_t rows, std::size_t columns) {
+        for (std::size_t r{0}; r < rows; ++r) {
+            auto& row = this->make_child<layout::Horizontal>();
+            for (std::size_t c{0}; c < columns; ++c) {
+                row.make_child<Widget>().focus_policy = Focus_policy::Strong;
+            }
+        }
+    }
+};
+
+/// Vertical nested \p depth levels deep, each level also holds one Widget.
+class Chain : public layout::Vertical {
+   public:
+    explicit Chain(std::size_t depth) {
+        layout::Vertical* level = this;
+        for (std::size_t i{0}; i < depth; ++i) {
+            level->make_child<Widget>();
+            level = &level->make_child<layout::Vertical>();
+        }
+    }
+};
+
+/// Lay out a tree state.range(0) levels deep, alternating its height.
+void layout_deep_tree(benchmark::State& state) {
+    bench::discard_events();
+    Chain chain{static_cast<std::size_t>(state.range(0))};
+    chain.enable();
+    bench::process_events();
+    auto extra = std::size_t{0};
+    for (auto _ : state) {
+        System::send_event(Resize_event{chain, Area{80, 200 + extra}});
+        bench::process_events();
+        extra = 1 - extra;
+    }
+}
+BENCHMARK(layout_deep_tree)->Arg(16)->Arg(64);
+
+/// Collect every descendant of a 32x32 Board, 1056 Widgets.
+void children_get_descendants(benchmark::State& state) {
+    Board board{32, 32};
+    for (auto _ : state) {
+        auto descendants = board.children.get_descendants();
+        benchmark::DoNotOptimize(descendants.data());
+    }
+    bench::discard_events();
+}
+BENCHMARK(children_get_descendants);
+
+/// Read the cached preorder descendants of the same Board.
+void children_descendants_cached(benchmark::State& state) {
+    Board board{32, 32};
+    for (auto _ : state) {
+        const auto& descendants = board.children.descendants();
+        benchmark::DoNotOptimize(descendants.data());
+    }
+    bench::discard_events();
+}
+BENCHMARK(children_descendants_cached);
+
+/// Ask whether the root of a 64 level Chain owns its deepest Widget.
+void children_has_descendant_deep(benchmark::State& state) {
+    Chain chain{64};
+    const Widget* deepest = &chain;
+    while (!deepest->children.get().empty()) {
+        deepest = deepest->children.get().back().get();
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(chain.children.has_descendant(deepest));
+    }
+    bench::discard_events();
+}
+BENCHMARK(children_has_descendant_deep);
+
+/// Find a named Widget at the far corner of a 32x32 Board by name.
+void widget_find_descendant(benchmark::State& state) {
+    Board board{32, 32};
+    board.children.get().back()->children.get().back()->set_name("target");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(board.find_descendant("target"));
+    }
+    bench::discard_events();
+}
+BENCHMARK(widget_find_descendant);
+
+/// Find the Widget under a cycle of points on a 32x32 Board at 192x96.
+void system_find_widget_at(benchmark::State& state) {
+    bench::discard_events();
+    bench::Headless_terminal terminal{Area{192, 96}};
+    Board board{32, 32};
+    System::set_head(&board);
+    bench::process_events();
+    auto x = std::size_t{0};
+    auto y = std::size_t{0};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(detail::find_widget_at(x, y));
+        x = (x + 7) % 192;
+        y = (y + 3) % 96;
+    }
+    System::set_head(nullptr);
+    bench::discard_events();
+}
+BENCHMARK(system_find_widget_at);
+
+/// Move focus with Tab through the 1024 focusable Widgets of a 32x32 Board.
+void focus_tab_press(benchmark::State& state) {
+    bench::discard_events();
+    bench::Headless_terminal terminal{Area{192, 96}};
+    Board board{32, 32};
+    System::set_head(&board);
+    bench::process_events();
+    Focus::set_focus_to(*board.children.get().front()->children.get().front());
+    for (auto _ : state) {
+        Focus::tab_press();
+        bench::discard_events();
+    }
+    Focus::clear();
+    System::set_head(nullptr);
+    bench::discard_events();
+}
+BENCHMARK(focus_tab_press);
+
+/// Post state.range(0) events, one to each of as many Widgets, then send them.
+void event_post_and_drain(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    bench::discard_events();
+    Widget parent;
+    std::vector<Widget*> receivers;
+    for (std::size_t i{0}; i < count; ++i) {
+        receivers.push_back(&parent.make_child<Widget>());
+    }
+    bench::discard_events();
+    for (auto _ : state) {
+        for (Widget* receiver : receivers) {
+            System::post_event<Child_polished_event>(*receiver, parent);
+        }
+        bench::process_events();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(event_post_and_drain)->Arg(1000)->Arg(100000);
+
+}  // namespace
@@ -1,7 +1,6 @@
 #include "paint_area.hpp"
 
 #include <cctype>
-#include <codecvt>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
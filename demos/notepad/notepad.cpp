@@ -1,16 +1,21 @@
 #include "notepad.hpp"
 
 #include <cppurses/painter/attribute.hpp>
+#include <cppurses/painter/brush.hpp>
 #include <cppurses/painter/color.hpp>
 #include <cppurses/system/focus.hpp>
 #include <cppurses/widget/border.hpp>
 #include <cppurses/widget/focus_policy.hpp>
 #include <cppurses/widget/widget_slots.hpp>
+#include <cppurses/widget/widgets/highlighter.hpp>
 
+#include <cstddef>
 #include <fstream>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -33,6 +38,42 @@ std::string load_file(const std::string& filename)
     return oss.str();
 }
 
+/// Colors C style // and /* */ comments.
+class Comment_highlighter : public cppurses::Highlighter {
+   public:
+    State highlight(const std::wstring& line,
+                    State state,
+                    std::vector<Span>& spans) const override
+    {
+        std::size_t begin{0};
+        for (std::size_t i{0}; i < line.size(); ++i) {
+            if (state == In_block && line.compare(i, 2, L"*/") == 0) {
+                ++i;
+                spans.push_back(Span{begin, i + 1 - begin, comment_});
+                state = Code;
+            }
+            else if (state == Code && line.compare(i, 2, L"/*") == 0) {
+                begin = i++;
+                state = In_block;
+            }
+            else if (state == Code && line.compare(i, 2, L"//") == 0) {
+                begin = i;
+                state = In_line;
+            }
+        }
+        if (state != Code)
+            spans.push_back(Span{begin, line.size() - begin, comment_});
+        // A line comment ends with its line, not where the line is wrapped.
+        if (state == In_line && !line.empty() && line.back() == L'\n')
+            state = Code;
+        return state;
+    }
+
+   private:
+    enum : State { Code, In_block, In_line };
+    const cppurses::Brush comment_{foreground(cppurses::Color::Green)};
+};
+
 }  // namespace
 
 using namespace cppurses;
@@ -50,6 +91,7 @@ void Text_and_attributes::initialize()
     textbox.border.segments.north_east = L'╮';
     textbox.border.segments.south_west = L'╰';
     textbox.border.segments.south_east = L'╯';
+    textbox.set_highlighter(std::make_unique<Comment_highlighter>());
 
     // Signals -- Colors
     ac_select.fg_select.color_changed.connect(slot::set_foreground(textbox));
@@ -159,7 +201,7 @@ void Notepad::initialize()
 
     save_area.save_btn.clicked.connect([this] {
         ::save_file(save_area.filename_edit.contents().str(),
-                    txt_attr.textbox.contents().str());
+                    txt_attr.textbox.text().str());
     });
 }
 }  // namespace demos
@@ -35,12 +35,12 @@ Value_control::Value_control(const Glyph_string& label)
                 slider.set_value(std::stoi(value_str));
             }
             edit_box.set_contents(std::to_string(slider.value()));
-            edit_box.set_cursor(edit_box.contents().size());
+            edit_box.set_cursor(edit_box.contents_size());
         });
 
     slider.value_changed.connect([&edit_box](int value) {
         edit_box.set_contents(std::to_string(value));
-        edit_box.set_cursor(edit_box.contents().size());
+        edit_box.set_cursor(edit_box.contents_size());
     });
 
     label_.set_alignment(Alignment::Center);
@@ -1,6 +1,8 @@
 #ifndef CPPURSES_WIDGET_HPP
 #define CPPURSES_WIDGET_HPP
 
+#include <cppurses/widget/layout_batch.hpp>
+#include <cppurses/widget/layouts/grid.hpp>
 #include <cppurses/widget/layouts/horizontal.hpp>
 #include <cppurses/widget/layouts/stack.hpp>
 #include <cppurses/widget/layouts/vertical.hpp>
@@ -12,11 +14,14 @@
 #include <cppurses/widget/widgets/cycle_stack.hpp>
 #include <cppurses/widget/widgets/fixed_height.hpp>
 #include <cppurses/widget/widgets/fixed_width.hpp>
+#include <cppurses/widget/widgets/highlighter.hpp>
 #include <cppurses/widget/widgets/horizontal_scrollbar.hpp>
 #include <cppurses/widget/widgets/label.hpp>
 #include <cppurses/widget/widgets/labeled_cycle_box.hpp>
 #include <cppurses/widget/widgets/labeled_number_edit.hpp>
 #include <cppurses/widget/widgets/line_edit.hpp>
+#include <cppurses/widget/widgets/list.hpp>
+#include <cppurses/widget/widgets/list_source.hpp>
 #include <cppurses/widget/widgets/log.hpp>
 #include <cppurses/widget/widgets/matrix_display.hpp>
 #include <cppurses/widget/widgets/menu.hpp>
@@ -0,0 +1,227 @@
+#ifndef CPPURSES_PAINTER_GLYPH_ROPE_HPP
+#define CPPURSES_PAINTER_GLYPH_ROPE_HPP
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/painter/glyph_string_view.hpp>
+
+namespace cppurses {
+namespace detail {
+struct Rope_node;
+}  // namespace detail
+
+/// Persistent sequence of Glyphs for large, frequently edited text.
+/** A balanced tree of Glyph chunks, insert and erase are O(log n) and only copy
+ *  the chunks and tree nodes along the edited path. Nodes are immutable and
+ *  shared between copies, so copying a Glyph_rope is O(1), which makes it
+ *  cheap to keep old versions around as undo snapshots. */
+class Glyph_rope {
+   public:
+    /// Used to indicate 'Until the end of the rope'.
+    static const std::size_t npos = -1;
+
+    class const_iterator;
+
+    /// Construct an empty Glyph_rope.
+    Glyph_rope() = default;
+
+    /// Construct with a copy of the Glyphs in \p glyphs.
+    explicit Glyph_rope(const Glyph_string& glyphs);
+
+    /// Return the number of Glyphs in the rope.
+    std::size_t size() const;
+
+    /// Return the length in Glyphs of the rope.
+    std::size_t length() const { return this->size(); }
+
+    /// Return true if there are no Glyphs in the rope.
+    bool empty() const { return this->size() == 0; }
+
+    /// Return the Glyph at \p index, O(log n). No bounds checking.
+    const Glyph& operator[](std::size_t index) const;
+
+    /// Return the Glyph at \p index, throws std::out_of_range if past the end.
+    const Glyph& at(std::size_t index) const;
+
+    /// Insert \p glyphs before \p index, which can be size() to append.
+    /** Throws std::out_of_range if \p index is past the end. */
+    void insert(std::size_t index, const Glyph_string& glyphs);
+
+    /// Append \p glyphs to the end of the rope.
+    void append(const Glyph_string& glyphs);
+
+    /// Remove \p count Glyphs starting at \p index, or up to the end.
+    /** Throws std::out_of_range if \p index is past the end. */
+    void erase(std::size_t index, std::size_t count = npos);
+
+    /// Remove the last Glyph. Undefined behavior if empty().
+    void pop_back() { this->erase(this->size() - 1, 1); }
+
+    /// Remove all Glyphs.
+    void clear() { root_.reset(); }
+
+    /// Return a copy of \p count Glyphs starting at \p index.
+    /** Stops early at the end of the rope. Throws std::out_of_range if \p index
+     *  is past the end. */
+    Glyph_string substr(std::size_t index, std::size_t count = npos) const;
+
+    /// Return a view of the contiguous run of Glyphs starting at \p index.
+    /** The run ends after \p count Glyphs or at the end of the chunk holding
+     *  \p index, whichever is first. O(log n), no copy. Loop, advancing by the
+     *  size of each view, to visit any range. Invalidated by modification.
+     *  Empty if \p index is past the end. */
+    Glyph_string_view chunk_at(std::size_t index,
+                               std::size_t count = npos) const;
+
+    /// Return a copy of the entire contents as a Glyph_string.
+    Glyph_string glyph_string() const { return this->substr(0); }
+
+    /// Convert to a std::string, each Glyph being a char.
+    std::string str() const { return this->glyph_string().str(); }
+
+    /// Return an iterator to the first Glyph.
+    const_iterator begin() const;
+
+    /// Return an iterator to one past the last Glyph.
+    const_iterator end() const;
+
+   private:
+    using Node = detail::Rope_node;
+
+    std::shared_ptr<const Node> root_;
+};
+
+/// Random access iterator over the Glyphs of a Glyph_rope.
+/** Holds a pointer to the chunk of the current position, so sequential access
+ *  is O(1) amortized and only moving into another chunk descends the tree.
+ *  Invalidated by any modification of the rope. */
+class Glyph_rope::const_iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = Glyph;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const Glyph*;
+    using reference         = const Glyph&;
+
+    const_iterator() = default;
+
+    /// Return the index into the rope of this position.
+    std::size_t index() const { return index_; }
+
+    reference operator*() const {
+        if (index_ - chunk_begin_ >= chunk_size_) {
+            this->seek();
+        }
+        return chunk_[index_ - chunk_begin_];
+    }
+
+    pointer operator->() const { return &**this; }
+
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    const_iterator& operator++() {
+        ++index_;
+        return *this;
+    }
+
+    const_iterator operator++(int) {
+        auto copy = *this;
+        ++index_;
+        return copy;
+    }
+
+    const_iterator& operator--() {
+        --index_;
+        return *this;
+    }
+
+    const_iterator operator--(int) {
+        auto copy = *this;
+        --index_;
+        return copy;
+    }
+
+    const_iterator& operator+=(difference_type n) {
+        index_ += n;
+        return *this;
+    }
+
+    const_iterator& operator-=(difference_type n) {
+        index_ -= n;
+        return *this;
+    }
+
+    friend const_iterator operator+(const_iterator it, difference_type n) {
+        return it += n;
+    }
+
+    friend const_iterator operator+(difference_type n, const_iterator it) {
+        return it += n;
+    }
+
+    friend const_iterator operator-(const_iterator it, difference_type n) {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const const_iterator& x,
+                                     const const_iterator& y) {
+        return static_cast<difference_type>(x.index_) -
+               static_cast<difference_type>(y.index_);
+    }
+
+    friend bool operator==(const const_iterator& x, const const_iterator& y) {
+        return x.index_ == y.index_;
+    }
+
+    friend bool operator!=(const const_iterator& x, const const_iterator& y) {
+        return x.index_ != y.index_;
+    }
+
+    friend bool operator<(const const_iterator& x, const const_iterator& y) {
+        return x.index_ < y.index_;
+    }
+
+    friend bool operator>(const const_iterator& x, const const_iterator& y) {
+        return y < x;
+    }
+
+    friend bool operator<=(const const_iterator& x, const const_iterator& y) {
+        return !(y < x);
+    }
+
+    friend bool operator>=(const const_iterator& x, const const_iterator& y) {
+        return !(x < y);
+    }
+
+   private:
+    friend class Glyph_rope;
+
+    const_iterator(const Node* root, std::size_t index)
+        : root_{root}, index_{index} {}
+
+    /// Find the chunk holding index_.
+    void seek() const;
+
+    const Node* root_{nullptr};
+    std::size_t index_{0};
+
+    // Cached chunk of the last dereferenced position.
+    mutable const Glyph* chunk_{nullptr};
+    mutable std::size_t chunk_begin_{0};
+    mutable std::size_t chunk_size_{0};
+};
+
+inline auto Glyph_rope::begin() const -> const_iterator {
+    return const_iterator{root_.get(), 0};
+}
+
+inline auto Glyph_rope::end() const -> const_iterator {
+    return const_iterator{root_.get(), this->size()};
+}
+
+}  // namespace cppurses
+#endif  // CPPURSES_PAINTER_GLYPH_ROPE_HPP
@@ -1,8 +1,7 @@
 #ifndef CPPURSES_PAINTER_GLYPH_STRING_HPP
 #define CPPURSES_PAINTER_GLYPH_STRING_HPP
-#include <codecvt>
+#include <cstring>
 #include <initializer_list>
-#include <locale>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -11,6 +10,7 @@
 
 #include <cppurses/painter/attribute.hpp>
 #include <cppurses/painter/glyph.hpp>
+#include <cppurses/painter/utility/utf8.hpp>
 #include <cppurses/painter/utility/wchar_to_bytes.hpp>
 
 namespace cppurses {
@@ -79,6 +79,7 @@ class Glyph_string : private std::vector<Glyph> {
     Glyph_string& append(const Glyph& symbol, Attributes&&... attrs);
 
     /// Append a c-string with given Attributes to the end of the Glyph_string.
+    /** The string is decoded as UTF-8, invalid sequences are replaced. */
     template <typename... Attributes>
     Glyph_string& append(const char* symbols, Attributes&&... attrs);
 
@@ -217,19 +218,16 @@ Glyph_string& Glyph_string::append(const Glyph& symbol, Attributes&&... attrs) {
 
 template <typename... Attributes>
 Glyph_string& Glyph_string::append(const char* symbols, Attributes&&... attrs) {
-    std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
-    std::wstring wide_string{converter.from_bytes(symbols)};
-    this->reserve(this->size() + wide_string.size());
-    for (wchar_t sym : wide_string) {
-        this->append(Glyph{sym, std::forward<Attributes>(attrs)...});
-    }
-    return *this;
+    const auto wide_string =
+        utility::bytes_to_wchar(std::string(symbols, std::strlen(symbols)));
+    return this->append(wide_string, std::forward<Attributes>(attrs)...);
 }
 
 template <typename... Attributes>
 Glyph_string& Glyph_string::append(const std::string& symbols,
                                    Attributes&&... attrs) {
-    return this->append(symbols.c_str(), std::forward<Attributes>(attrs)...);
+    const auto wide_string = utility::bytes_to_wchar(symbols);
+    return this->append(wide_string, std::forward<Attributes>(attrs)...);
 }
 
 template <typename... Attributes>
@@ -244,6 +242,7 @@ Glyph_string& Glyph_string::append(const wchar_t* symbols,
 template <typename... Attributes>
 Glyph_string& Glyph_string::append(const std::wstring& symbols,
                                    Attributes&&... attrs) {
+    this->reserve(this->size() + symbols.size());
     for (wchar_t sym : symbols) {
         this->append(Glyph{sym, std::forward<Attributes>(attrs)...});
     }
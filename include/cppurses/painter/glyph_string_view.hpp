@@ -0,0 +1,74 @@
+#ifndef CPPURSES_PAINTER_GLYPH_STRING_VIEW_HPP
+#define CPPURSES_PAINTER_GLYPH_STRING_VIEW_HPP
+#include <algorithm>
+#include <cstddef>
+
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/painter/glyph_string.hpp>
+
+namespace cppurses {
+
+/// Non-owning view of a contiguous run of Glyphs.
+/** Cheap to copy and pass by value. The viewed Glyphs must outlive the view,
+ *  any modification of the underlying storage can invalidate it. */
+class Glyph_string_view {
+   public:
+    using const_iterator = const Glyph*;
+
+    /// Used to indicate 'Until the end of the view'.
+    static const std::size_t npos = -1;
+
+    /// Construct an empty view.
+    Glyph_string_view() = default;
+
+    /// View \p size Glyphs starting at \p data.
+    Glyph_string_view(const Glyph* data, std::size_t size)
+        : data_{data}, size_{size} {}
+
+    /// View the entire contents of \p text.
+    Glyph_string_view(const Glyph_string& text)
+        : data_{text.data()}, size_{text.size()} {}
+
+    /// Return a pointer to the first Glyph viewed.
+    const Glyph* data() const { return data_; }
+
+    /// Return the number of Glyphs viewed.
+    std::size_t size() const { return size_; }
+
+    /// Return the number of Glyphs viewed.
+    std::size_t length() const { return size_; }
+
+    /// Return true if no Glyphs are viewed.
+    bool empty() const { return size_ == 0; }
+
+    /// Return the Glyph at \p index. No bounds checking.
+    const Glyph& operator[](std::size_t index) const { return data_[index]; }
+
+    const_iterator begin() const { return data_; }
+
+    const_iterator end() const { return data_ + size_; }
+
+    /// Return a view of \p count Glyphs starting at \p index, clamped.
+    Glyph_string_view substr(std::size_t index,
+                             std::size_t count = npos) const {
+        index = std::min(index, size_);
+        return {data_ + index, std::min(count, size_ - index)};
+    }
+
+    /// Stop viewing the first \p count Glyphs, clamped to size().
+    void remove_prefix(std::size_t count) {
+        count = std::min(count, size_);
+        data_ += count;
+        size_ -= count;
+    }
+
+    /// Return an owning copy of the viewed Glyphs.
+    Glyph_string glyph_string() const { return Glyph_string(begin(), end()); }
+
+   private:
+    const Glyph* data_{nullptr};
+    std::size_t size_{0};
+};
+
+}  // namespace cppurses
+#endif  // CPPURSES_PAINTER_GLYPH_STRING_VIEW_HPP
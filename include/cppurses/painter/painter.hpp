@@ -4,6 +4,7 @@
 
 #include <cppurses/painter/detail/screen_descriptor.hpp>
 #include <cppurses/painter/detail/staged_changes.hpp>
+#include <cppurses/painter/glyph_string_view.hpp>
 #include <cppurses/widget/area.hpp>
 
 namespace cppurses {
@@ -31,13 +32,25 @@ class Painter {
     }
 
     /// Put Glyph_string to local coordinates, no-op if out of Widget's bounds
-    void put(const Glyph_string& text, std::size_t x, std::size_t y);
+    void put(const Glyph_string& text, std::size_t x, std::size_t y) {
+        this->put(Glyph_string_view{text}, x, y);
+    }
 
     /// Put Glyph_string to local coordinates, no-op if out of Widget's bounds
     void put(const Glyph_string& text, const Point& position) {
         this->put(text, position.x, position.y);
     }
 
+    /// Put a run of Glyphs to local coordinates, clipped to Widget's bounds.
+    /** The run is clipped once, then the visible Glyphs are staged without
+     *  further checks. Nothing is copied beyond the staged Glyphs. */
+    void put(Glyph_string_view text, std::size_t x, std::size_t y);
+
+    /// Put a run of Glyphs to local coordinates, clipped to Widget's bounds.
+    void put(Glyph_string_view text, const Point& position) {
+        this->put(text, position.x, position.y);
+    }
+
     /// Paint the Border object around the outside of the associated Widget.
     /** Borders own the perimeter defined by Widget::x(), Widget::y() and
      *  Widget::outer_width(), Widget::outer_height(). Border is owned by
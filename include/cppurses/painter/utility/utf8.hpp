@@ -0,0 +1,30 @@
+#ifndef CPPURSES_PAINTER_UTILITY_UTF8_HPP
+#define CPPURSES_PAINTER_UTILITY_UTF8_HPP
+#include <cstddef>
+#include <string>
+
+namespace cppurses {
+namespace utility {
+
+/// Code point written in place of each invalid sequence.
+constexpr wchar_t replacement_character = L'�';
+
+/// Decode the UTF-8 in [first, last) into \p out, return the count written.
+/** \p out must have room for (last - first) wchar_ts. Each malformed, overlong,
+ *  surrogate or truncated sequence is written as one replacement_character,
+ *  the longest valid prefix of a sequence is replaced as a unit, as Unicode
+ *  recommends. Runs of ASCII are widened in bulk. */
+std::size_t decode_utf8(const char* first, const char* last, wchar_t* out);
+
+/// Encode [first, last) as UTF-8 into \p out, return the count written.
+/** \p out must have room for 4 * (last - first) chars. Surrogates and values
+ *  past U+10FFFF are encoded as replacement_character. Runs of ASCII are
+ *  narrowed in bulk. */
+std::size_t encode_utf8(const wchar_t* first, const wchar_t* last, char* out);
+
+/// Return the UTF-8 \p bytes decoded into a std::wstring.
+std::wstring bytes_to_wchar(const std::string& bytes);
+
+}  // namespace utility
+}  // namespace cppurses
+#endif  // CPPURSES_PAINTER_UTILITY_UTF8_HPP
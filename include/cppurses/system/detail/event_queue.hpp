@@ -26,6 +26,9 @@ class Event_queue {
 
    public:
     /// Place \p event at the back of the queue.
+    /** A MouseMove Event replaces a MouseMove Event for the same receiver if
+     *  that is the last general Event waiting in the queue, the latest mouse
+     *  position wins. */
     auto append(std::unique_ptr<Event> event) -> void
     {
         Guard_t g{mtx_};
@@ -34,6 +37,11 @@ class Event_queue {
             paint_events_.emplace_back(std::move(event));
         else if (type == Event::Delete)
             delete_events_.emplace_back(std::move(event));
+        else if (type == Event::MouseMove && !general_events_.empty() &&
+                 general_events_.back() != nullptr &&
+                 *general_events_.back() == *event) {
+            general_events_.back() = std::move(event);
+        }
         else
             general_events_.emplace_back(std::move(event));
     }
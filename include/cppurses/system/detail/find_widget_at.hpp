@@ -10,7 +10,9 @@ namespace detail {
 /** Return nullptr on failing to find a Widget with the provided coordinates.
  *  Return the deepest child Widget that owns the coordinates. If a parent owns
  *  the coordinates, it is checked if any of the children own it as well before
- *  returning. Used only by input::get at the moment. */
+ *  returning. Each level is searched through the parent's detail::Hit_index,
+ *  which is O(log n) in the number of children for non-overlapping layouts.
+ *  Used only by input::get at the moment. */
 Widget* find_widget_at(std::size_t x, std::size_t y);
 
 }  // namespace detail
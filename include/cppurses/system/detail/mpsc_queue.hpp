@@ -0,0 +1,74 @@
+#ifndef CPPURSES_SYSTEM_DETAIL_MPSC_QUEUE_HPP
+#define CPPURSES_SYSTEM_DETAIL_MPSC_QUEUE_HPP
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace cppurses {
+namespace detail {
+
+/// Lock-free multiple producer, single consumer queue.
+/** Producers push onto an atomic singly linked stack. The consumer takes the
+ *  whole stack with one exchange and reverses it, so values come out in the
+ *  order they were pushed. A single consumer thread must call pop_all(). */
+template <typename T>
+class Mpsc_queue {
+   public:
+    Mpsc_queue() = default;
+    Mpsc_queue(const Mpsc_queue&) = delete;
+    Mpsc_queue& operator=(const Mpsc_queue&) = delete;
+
+    ~Mpsc_queue() { destroy(head_.load(std::memory_order_acquire)); }
+
+    /// Append \p value to the queue, thread safe and lock-free.
+    /** Return true if the queue was empty before this push, so the caller can
+     *  schedule a single pop_all() for each batch of pushes. */
+    bool push(T value) {
+        auto* node = new Node{std::move(value), nullptr};
+        node->next = head_.load(std::memory_order_relaxed);
+        while (!head_.compare_exchange_weak(node->next, node,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+        }
+        return node->next == nullptr;
+    }
+
+    /// Remove and return every value in the queue, oldest first.
+    std::vector<T> pop_all() {
+        Node* node = head_.exchange(nullptr, std::memory_order_acquire);
+        auto values = std::vector<T>{};
+        for (auto* n = node; n != nullptr; n = n->next) {
+            values.push_back(std::move(n->value));
+        }
+        destroy(node);
+        std::reverse(std::begin(values), std::end(values));
+        return values;
+    }
+
+    /// Return true if nothing is waiting. Only a hint while producers run.
+    bool empty() const {
+        return head_.load(std::memory_order_relaxed) == nullptr;
+    }
+
+   private:
+    struct Node {
+        T value;
+        Node* next;
+    };
+
+    std::atomic<Node*> head_{nullptr};
+
+    static void destroy(Node* node) {
+        while (node != nullptr) {
+            auto* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_SYSTEM_DETAIL_MPSC_QUEUE_HPP
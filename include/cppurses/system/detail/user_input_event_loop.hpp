@@ -13,7 +13,7 @@ class User_input_event_loop : public Event_loop {
     User_input_event_loop() { Event_loop::is_main_thread_ = true; }
 
    protected:
-    /// Wait on input::get(), and post the result.
+    /// Wait on input::get_pending(), and post the results.
     auto loop_function() -> bool override;
 };
 
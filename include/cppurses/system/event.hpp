@@ -21,6 +21,7 @@ class Event {
         MouseMove,
         KeyPress,
         KeyRelease,
+        Paste,
         FocusIn,
         FocusOut,
         Paint,
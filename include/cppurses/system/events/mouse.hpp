@@ -14,6 +14,8 @@ struct Mouse {
     /// Holds data from a Mouse Input Event.
     struct State {
         /// The mouse button used for the input event.
+        /** For Move events this is the button held during a drag, or
+         *  Button::None if the mouse is hovering. */
         Button button;
 
         /// The terminal screen global coordinate of the input event.
@@ -66,7 +68,7 @@ struct Mouse {
         bool filter_send(Widget& filter) const override;
     };
 
-    /// Mouse Move Event. Not currently implemented.
+    /// Mouse Move Event, sent on motion with or without a button held.
     struct Move : Mouse::Event {
         Move(Widget& receiver, const State& data);
         bool send() const override;
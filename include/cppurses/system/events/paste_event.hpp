@@ -0,0 +1,25 @@
+#ifndef CPPURSES_SYSTEM_EVENTS_PASTE_EVENT_HPP
+#define CPPURSES_SYSTEM_EVENTS_PASTE_EVENT_HPP
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/system/events/input_event.hpp>
+
+namespace cppurses {
+class Widget;
+
+/// Delivers an entire bracketed paste from the terminal as a single Event.
+/** Sent to the focus Widget in place of one Key::Press per pasted character.
+ *  Line endings are normalized to '\n'. */
+class Paste_event : public Input_event {
+   public:
+    Paste_event(Widget& receiver, Glyph_string text);
+
+    bool send() const override;
+
+    bool filter_send(Widget& filter) const override;
+
+   private:
+    const Glyph_string text_;
+};
+
+}  // namespace cppurses
+#endif  // CPPURSES_SYSTEM_EVENTS_PASTE_EVENT_HPP
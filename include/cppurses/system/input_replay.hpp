@@ -0,0 +1,49 @@
+#ifndef CPPURSES_SYSTEM_INPUT_REPLAY_HPP
+#define CPPURSES_SYSTEM_INPUT_REPLAY_HPP
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+#include <cppurses/system/event_loop.hpp>
+#include <cppurses/terminal/input_record.hpp>
+
+namespace cppurses {
+
+/// Event_loop that feeds an Input_recorder recording back into the System.
+/** Runs on the main thread in place of the user input loop, pass it to
+ *  System::run(Event_loop&). Each iteration posts one recorded batch of input,
+ *  so Events are processed and the screen is flushed as they were live. The
+ *  loop exits with a return code of zero once the recording is exhausted. */
+class Input_replay : public Event_loop {
+   public:
+    /// Fastest posts each batch as soon as the last one has been processed.
+    /** Original waits between batches as long as the recorded user did. */
+    enum class Speed { Fastest, Original };
+
+    /// Open the recording at \p filename, to be replayed at \p speed.
+    /** Throws std::runtime_error if the file cannot be opened or is not an
+     *  input recording. */
+    explicit Input_replay(const std::string& filename,
+                          Speed speed = Speed::Fastest);
+
+    /// Return the number of records that have been posted so far.
+    auto records_replayed() const -> std::size_t { return replayed_; }
+
+   protected:
+    /// Post the next batch of records, exit if there are none left.
+    auto loop_function() -> bool override;
+
+   private:
+    using Clock_t = std::chrono::steady_clock;
+
+    std::ifstream file_;
+    Speed speed_;
+    Input_record next_;
+    bool has_next_{false};
+    std::size_t replayed_{0};
+    Clock_t::time_point last_batch_;
+};
+
+}  // namespace cppurses
+#endif  // CPPURSES_SYSTEM_INPUT_REPLAY_HPP
@@ -1,5 +1,6 @@
 #ifndef CPPURSES_SYSTEM_SYSTEM_HPP
 #define CPPURSES_SYSTEM_SYSTEM_HPP
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -12,9 +13,11 @@
 #include <cppurses/system/detail/user_input_event_loop.hpp>
 #include <cppurses/system/event.hpp>
 #include <cppurses/terminal/terminal.hpp>
+#include <cppurses/widget/detail/widget_registry.hpp>
 
 namespace cppurses {
 class Animation_engine;
+class Event_loop;
 class Widget;
 
 /// Organizes the highest level of the TUI framework.
@@ -67,6 +70,12 @@ class System {
      *  a std::runtime_error if screen cannot be initialized. */
     int run();
 
+    /// Run \p main_loop in place of the user input loop.
+    /** Used to drive the System from something other than the terminal, such
+     *  as an Input_replay. \p main_loop must be a main thread Event_loop. Has
+     *  the same behavior as run() otherwise. */
+    int run(Event_loop& main_loop);
+
     /// Immediately send the event filters and then to the intended receiver.
     static auto send_event(const Event& event) -> bool
     {
@@ -95,6 +104,18 @@ class System {
         System::post_event(std::move(event));
     }
 
+    /// Post a newly created Event of type T to the Widget with \p id.
+    /** T is constructed with the Widget, followed by \p args..., if the Widget
+     *  is still alive. Safe to call from any thread, even if the Widget may
+     *  have been deleted. Returns false, posting nothing, if it has been. */
+    template <typename T, typename... Args>
+    static auto post_event_to(std::uint64_t id, Args&&... args) -> bool
+    {
+        return detail::Widget_registry::visit(id, [&](Widget& receiver) {
+            System::post_event<T>(receiver, std::forward<Args>(args)...);
+        });
+    }
+
     /// Send an exit signal to each of the currently running Event_loops.
     /** Also call shutdown() on the Animation_engine and set
      *  System::exit_requested_ to true. Though it sends the exit signal to each
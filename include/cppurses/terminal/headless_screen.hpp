@@ -0,0 +1,129 @@
+#ifndef CPPURSES_TERMINAL_HEADLESS_SCREEN_HPP
+#define CPPURSES_TERMINAL_HEADLESS_SCREEN_HPP
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/painter/glyph_matrix.hpp>
+#include <cppurses/terminal/input_record.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/point.hpp>
+
+namespace cppurses {
+
+/// In-memory terminal, used in place of curses when there is no TTY.
+/** Install with Terminal::use_headless() before the Terminal is initialized,
+ *  output is then written to a Glyph grid and input is taken from records
+ *  injected with inject(). Output is only touched by the thread running the
+ *  Event_loop, snapshot(), stats() and inject() can be called from any
+ *  thread. */
+class Headless_screen {
+   public:
+    /// Counters for the output written to the screen.
+    struct Stats {
+        /// Number of Glyphs put to the screen.
+        std::size_t cells{0};
+
+        /// Number of Glyphs put that differ from what was already displayed.
+        std::size_t cells_changed{0};
+
+        /// Estimate of the bytes a terminal would be sent for the output.
+        /** Counts the UTF-8 encoding of each symbol, a cursor positioning
+         *  sequence for each non-contiguous put and an SGR sequence for each
+         *  change of Brush. Does not model the diffing curses does on
+         *  refresh. */
+        std::size_t bytes{0};
+
+        /// Number of calls to output::refresh().
+        std::size_t refreshes{0};
+    };
+
+    /// Construct a screen of \p size, filled with blank Glyphs.
+    explicit Headless_screen(Area size = Area{80, 24});
+
+    /// Return the width of the screen.
+    std::size_t width() const;
+
+    /// Return the height of the screen.
+    std::size_t height() const;
+
+    /// Change the size of the screen and inject the matching resize input.
+    /** Cells outside of the new size are lost, new cells are blank. */
+    void resize(Area size);
+
+    /// Return a copy of the current contents of the screen.
+    Glyph_matrix snapshot() const;
+
+    /// Return the Glyph displayed at \p x, \p y. Throws std::out_of_range.
+    Glyph at(std::size_t x, std::size_t y) const;
+
+    /// Return the symbols on row \p y as a string, without Brushes.
+    std::wstring row(std::size_t y) const;
+
+    /// Return the output counters accumulated since the last reset_stats().
+    Stats stats() const;
+
+    /// Set all output counters to zero.
+    void reset_stats();
+
+    /// Return the cursor position, as last set by move_cursor() and put().
+    Point cursor() const;
+
+    /// Return whether the cursor is currently shown.
+    bool cursor_visible() const;
+
+    /// Queue \p record to be read as if it was typed at the terminal.
+    /** Wakes a thread blocked in next_input(). */
+    void inject(Input_record record);
+
+    /// Wait up to \p timeout for injected input and move it into \p record.
+    /** Return false if no input arrived in time. */
+    bool next_input(Input_record& record, std::chrono::milliseconds timeout);
+
+    /// Move already injected input into \p record without waiting.
+    /** If \p accept is given the next record is only taken if it returns true
+     *  for it, otherwise it is left queued. Return false if nothing was
+     *  taken. */
+    bool poll_input(Input_record& record,
+                    bool (*accept)(const Input_record&) = nullptr);
+
+    // Backend for output:: and Terminal, not intended to be called directly.
+
+    /// Move the cursor to \p x, \p y.
+    void move_cursor(std::size_t x, std::size_t y);
+
+    /// Write \p glyph at the cursor and advance the cursor, wrapping lines.
+    /** Writes outside of the screen are dropped, as curses does. */
+    void put(const Glyph& glyph);
+
+    /// Count a refresh of the screen.
+    void refresh();
+
+    /// Show or hide the cursor.
+    void show_cursor(bool show);
+
+   private:
+    mutable std::mutex mtx_;
+    Glyph_matrix cells_;
+    Stats stats_;
+    Point cursor_;
+    bool cursor_visible_{false};
+
+    // Emulated terminal state, used for the byte estimate.
+    Point written_cursor_{~std::size_t{0}, ~std::size_t{0}};
+    Brush written_brush_;
+    bool has_written_brush_{false};
+
+    std::mutex input_mtx_;
+    std::condition_variable input_cv_;
+    std::deque<Input_record> input_;
+};
+
+}  // namespace cppurses
+#endif  // CPPURSES_TERMINAL_HEADLESS_SCREEN_HPP
@@ -1,16 +1,45 @@
 #ifndef CPPURSES_TERMINAL_INPUT_HPP
 #define CPPURSES_TERMINAL_INPUT_HPP
 #include <memory>
+#include <vector>
 
 namespace cppurses {
 class Event;
+struct Input_record;
 namespace input {
 
 /// Wait for user input, and return with a corresponding Event.
 /** Blocking call, input can be received from the keyboard, mouse, or the
- *  terminal being resized. Will return nullptr if there is an error. */
+ *  terminal being resized. Will return nullptr if there is an error. If the
+ *  Terminal is headless, input is read from the Headless_screen instead. */
 auto get() -> std::unique_ptr<Event>;
 
+/// Wait for user input, then collect any further input that is already queued.
+/** Blocks like get() for the first input. The terminal is then read without
+ *  blocking for as long as text or mouse motion is pending, so a burst of
+ *  typing or a fast drag is handled in a single event loop iteration. A run of
+ *  motion reports is coalesced into one Mouse::Move Event for the latest
+ *  position. Other input is left queued for the next call, so Events that
+ *  might move focus or trigger shortcuts are not resolved before the input
+ *  ahead of them is processed. A bracketed paste is returned as a single
+ *  Paste_event. */
+auto get_pending() -> std::vector<std::unique_ptr<Event>>;
+
+/// Create the Event that \p record represents, resolving its receiver.
+/** Keys are offered to Shortcuts and then sent to the focus Widget, mouse
+ *  input goes to the Widget under the cursor, resizes go to the head Widget
+ *  and pastes to the focus Widget. Returns nullptr if there is no receiver.
+ *  Used by get() and get_pending(), and by Input_replay. */
+auto make_event(const Input_record& record) -> std::unique_ptr<Event>;
+
+/// Enable input modes that curses does not manage, paste and motion reports.
+/** Called by Terminal::initialize(). */
+auto initialize() -> void;
+
+/// Reset the input modes set by initialize().
+/** Called by Terminal::uninitialize(). */
+auto uninitialize() -> void;
+
 }  // namespace input
 }  // namespace cppurses
 #endif  // CPPURSES_TERMINAL_INPUT_HPP
@@ -0,0 +1,70 @@
+#ifndef CPPURSES_TERMINAL_INPUT_RECORD_HPP
+#define CPPURSES_TERMINAL_INPUT_RECORD_HPP
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+
+#include <cppurses/system/event.hpp>
+#include <cppurses/system/events/mouse.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/point.hpp>
+
+namespace cppurses {
+
+/// A single unit of terminal input, as read by the input layer.
+/** Input_records are what input::make_event() turns into Events, and what the
+ *  Input_recorder logs. Receivers are not stored, they are resolved by
+ *  make_event(), so a replayed record goes to whichever Widget would receive
+ *  the same input live. */
+struct Input_record {
+    enum class Kind : std::uint8_t { Key, Mouse, Resize, Paste };
+
+    Kind kind{Kind::Key};
+
+    /// True if read by the same input::get_pending() call as the last record.
+    bool batched{false};
+
+    /// Microseconds between the start of the previous batch and this record.
+    /** Filled in by the Input_recorder, always zero for batched records. */
+    std::uint64_t delay{0};
+
+    /// Kind::Key, the key code as returned from ncurses.
+    int key{0};
+
+    /// Kind::Mouse, MouseButtonPress, MouseButtonRelease or MouseMove.
+    Event::Type mouse_type{Event::None};
+
+    /// Kind::Mouse, the button pressed, released or held.
+    Mouse::Button button{Mouse::Button::None};
+
+    /// Kind::Mouse, the global screen coordinates of the input.
+    Point position;
+
+    /// Kind::Mouse, the input device's ID.
+    short device_id{0};
+
+    /// Kind::Resize, the new dimensions of the terminal.
+    Area area{0, 0};
+
+    /// Kind::Paste, UTF-8 text with line endings normalized to '\n'.
+    std::string text;
+};
+
+/// Write the header identifying an input recording to \p os.
+void write_record_header(std::ostream& os);
+
+/// Read the header written by write_record_header(), return false if invalid.
+bool read_record_header(std::istream& is);
+
+/// Write \p record to \p os in a compact binary encoding.
+/** Integers are stored as variable length unsigned values, most input records
+ *  take under eight bytes. */
+void write_record(std::ostream& os, const Input_record& record);
+
+/// Read the next record from \p is into \p record.
+/** Return false at the end of the stream or if the data is malformed. */
+bool read_record(std::istream& is, Input_record& record);
+
+}  // namespace cppurses
+#endif  // CPPURSES_TERMINAL_INPUT_RECORD_HPP
@@ -0,0 +1,40 @@
+#ifndef CPPURSES_TERMINAL_INPUT_RECORDER_HPP
+#define CPPURSES_TERMINAL_INPUT_RECORDER_HPP
+#include <chrono>
+#include <fstream>
+#include <string>
+
+#include <cppurses/terminal/input_record.hpp>
+
+namespace cppurses {
+
+/// Logs all terminal input to a file, to be played back by Input_replay.
+/** Each Input_record read by the input layer is written with the time since
+ *  the previous batch of input, in the format of write_record(). */
+class Input_recorder {
+   public:
+    /// Start recording input to \p filename, replacing any existing file.
+    /** Stops any recording already in progress. Throws std::runtime_error if
+     *  the file cannot be opened. */
+    static void start(const std::string& filename);
+
+    /// Stop recording and close the file. No-op if not recording.
+    static void stop();
+
+    /// Return whether input is currently being recorded.
+    static bool is_recording() { return file_.is_open(); }
+
+    /// Stamp \p record with its delay and write it to the recording.
+    /** Called by the input layer on each record read. No-op if not
+     *  recording. */
+    static void record(Input_record record);
+
+   private:
+    using Clock_t = std::chrono::steady_clock;
+
+    static std::ofstream file_;
+    static Clock_t::time_point last_batch_;
+};
+
+}  // namespace cppurses
+#endif  // CPPURSES_TERMINAL_INPUT_RECORDER_HPP
@@ -8,13 +8,24 @@
 #include <cppurses/painter/palettes.hpp>
 
 namespace cppurses {
+class Headless_screen;
 
 class Terminal {
    public:
+    /// Use \p screen for all output and input instead of curses.
+    /** Must be called before initialize(), throws std::logic_error otherwise.
+     *  Allows applications to run without a TTY, for tests and benchmarks.
+     *  \p screen is not owned and must outlive its use, pass nullptr to return
+     *  to curses. */
+    void use_headless(Headless_screen* screen);
+
+    /// Return the Headless_screen in use, or nullptr if using curses.
+    Headless_screen* headless() const { return headless_; }
+
     /// Initializes the terminal screen into curses mode.
     /** Must be called before any input/output can occur. Also initializes
      *  various proerties that are modifiable from this Terminal class. No-op if
-     *  already initialized. */
+     *  already initialized. Curses is skipped if use_headless() was called. */
     void initialize();
 
     /// Reset the terminal to its state before initialize() was called.
@@ -32,6 +43,12 @@ class Terminal {
      *  processed every refresh rate. Default is 33ms. */
     auto set_refresh_rate(std::chrono::milliseconds duration) -> void;
 
+    /// Return the rate at which the screen will update.
+    auto refresh_rate() const -> std::chrono::milliseconds
+    {
+        return refresh_rate_;
+    }
+
     /// Set the default background/wallpaper tiles to be used.
     /** This is used if a Widget has no assigned wallpaper. */
     void set_background(const Glyph& tile);
@@ -86,6 +103,13 @@ class Terminal {
     Glyph background_{L' '};
     Palette palette_{Palettes::DawnBringer()};
     std::chrono::milliseconds refresh_rate_{33};
+    Headless_screen* headless_{nullptr};
+
+    /// Return true if curses is initialized, false if headless.
+    bool uses_curses() const
+    {
+        return is_initialized_ && headless_ == nullptr;
+    }
 
     /// Actually set the palette via ncurses using the state of \p colors.
     void ncurses_set_palette(const Palette& colors);
@@ -10,5 +10,13 @@ struct Area {
     std::size_t height;
 };
 
+inline bool operator==(const Area& lhs, const Area& rhs) {
+    return lhs.width == rhs.width && lhs.height == rhs.height;
+}
+
+inline bool operator!=(const Area& lhs, const Area& rhs) {
+    return !(lhs == rhs);
+}
+
 }  // namespace cppurses
 #endif  // CPPURSES_WIDGET_AREA_HPP
@@ -1,17 +1,23 @@
 #ifndef CPPURSES_WIDGET_CHILDREN_DATA_HPP
 #define CPPURSES_WIDGET_CHILDREN_DATA_HPP
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <cppurses/widget/detail/hit_index.hpp>
+
 namespace cppurses {
 class Widget;
 
 /// Contains all data relevant to child Widgets for the Widget class.
 class Children_data {
    public:
+    using Name_index = std::unordered_multimap<std::string, Widget*>;
+
     /// Must pass in the parent so that newly added Widgets can know about them.
     Children_data(Widget* parent) : parent_{parent} {}
 
@@ -27,10 +33,12 @@ class Children_data {
     bool has(Widget* child) const;
 
     /// Check if the owning Widget has the child with \p name.
+    /** O(1) for a non-empty \p name, through the name index. */
     bool has(const std::string& name) const;
 
     /// Check if the owning Widget recursively owns \p descendant.
-    bool has_descendant(Widget* descendant) const;
+    /** Walks up the parents of \p descendant, O(depth). */
+    bool has_descendant(const Widget* descendant) const;
 
     /// Check if the owning Widget has the descendent with \p name.
     bool has_descendant(const std::string& name) const;
@@ -40,10 +48,25 @@ class Children_data {
         return children_;
     }
 
+    /// Return the range of children named \p name, in no particular order.
+    /** Unnamed children are not indexed, an empty \p name finds none. */
+    std::pair<Name_index::const_iterator, Name_index::const_iterator> named(
+        const std::string& name) const {
+        return names_.equal_range(name);
+    }
+
     /// Return a list of all descendants in breadth first order.
-    /** Descendants are children, or children of children to any level down. */
+    /** Descendants are children, or children of children to any level down.
+     *  Builds a new vector each call, prefer descendants(). */
     std::vector<Widget*> get_descendants() const;
 
+    /// Return all descendants in preorder, cached until the subtree changes.
+    /** Each child comes before its own descendants. The cache is rebuilt
+     *  only after a child is appended, inserted or removed somewhere below
+     *  the owning Widget, so repeated calls do not allocate. Such a change
+     *  invalidates the returned reference. */
+    const std::vector<Widget*>& descendants() const;
+
     /// Remove \p child from the list, by pointer value, and return it.
     /** Useful if you need to move a child Widget into another Widget. Use
      *  Widget::close() if you want to remove a Widget for good. Letting the
@@ -54,10 +77,50 @@ class Children_data {
     /// Remove a child from the list, by name, and return it.
     std::unique_ptr<Widget> remove(const std::string& name);
 
+    /// Return a counter incremented whenever any Widget gains or loses a child.
+    /** Lets caches built from the Widget tree tell when to rebuild. */
+    static std::uint64_t generation() { return generation_; }
+
+    /// Return the generation() of the last change below the owning Widget.
+    /** Changes when a child is appended, inserted or removed anywhere in the
+     *  subtree, and not for changes elsewhere in the Widget tree. */
+    std::uint64_t subtree_generation() const { return subtree_generation_; }
+
+    /// Return the index used to find the child at a given screen coordinate.
+    detail::Hit_index& hit_index() const { return hit_index_; }
+
    private:
     friend class Widget;
     Widget* parent_;
     std::vector<std::unique_ptr<Widget>> children_;
+    mutable detail::Hit_index hit_index_;
+
+    /// Children by name, kept up to date by Widget::set_name().
+    Name_index names_;
+
+    /// Incremented whenever a child is added to or removed from any Widget.
+    static std::uint64_t generation_;
+
+    /// generation_ as of the last change in this subtree.
+    std::uint64_t subtree_generation_{1};
+
+    /// Record a change in this subtree on the owner and its ancestors.
+    void mark_changed();
+
+    /// Preorder descendants, valid while descendants_generation_ matches.
+    mutable std::vector<Widget*> descendants_;
+    mutable std::uint64_t descendants_generation_{0};
+
+    /// Add \p child to names_ under its current name.
+    void index_name(Widget& child);
+
+    /// Remove \p child from names_ under \p name.
+    void unindex_name(const Widget& child, const std::string& name);
+
+    /// Append \p children and their descendants to \p out, in preorder.
+    static void append_preorder(
+        const std::vector<std::unique_ptr<Widget>>& children,
+        std::vector<Widget*>& out);
 };
 
 }  // namespace cppurses
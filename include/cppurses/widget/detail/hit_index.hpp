@@ -0,0 +1,51 @@
+#ifndef CPPURSES_WIDGET_DETAIL_HIT_INDEX_HPP
+#define CPPURSES_WIDGET_DETAIL_HIT_INDEX_HPP
+#include <cstddef>
+#include <vector>
+
+namespace cppurses {
+class Widget;
+namespace detail {
+
+/// Sorted interval index over the enabled children of a Widget.
+/** Used to find the child at a screen coordinate in O(log n). The index is
+ *  built lazily from the children's outer geometry when they do not overlap
+ *  along one axis, as with the Vertical and Horizontal layouts. Otherwise, and
+ *  for small numbers of children, a linear scan is used. Must be invalidated
+ *  whenever a child is moved, resized, enabled, disabled, added or removed. */
+class Hit_index {
+   public:
+    /// Return the enabled child of \p parent that owns global (x, y).
+    /** Returns nullptr if no child owns the coordinates. */
+    Widget* find(const Widget& parent, std::size_t x, std::size_t y);
+
+    /// Mark the index as out of date with the children's geometry.
+    void invalidate() { stale_ = true; }
+
+    /// Return true if \p w is enabled and its inner area contains (x, y).
+    static bool contains(const Widget& w, std::size_t x, std::size_t y);
+
+   private:
+    /// Half open range [begin, end) along the indexed axis.
+    struct Interval {
+        std::size_t begin;
+        std::size_t end;
+        Widget* widget;
+    };
+
+    enum class Axis { None, Horizontal, Vertical };
+
+    std::vector<Interval> intervals_;
+    Axis axis_{Axis::None};
+    bool stale_{true};
+
+    /// Sort the enabled children of \p parent along the first disjoint axis.
+    void rebuild(const Widget& parent);
+
+    /// Fill intervals_ along \p axis, return false if any intervals overlap.
+    bool build_axis(const Widget& parent, Axis axis);
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_DETAIL_HIT_INDEX_HPP
@@ -0,0 +1,53 @@
+#ifndef CPPURSES_WIDGET_DETAIL_SHARE_SPACE_HPP
+#define CPPURSES_WIDGET_DETAIL_SHARE_SPACE_HPP
+#include <cstddef>
+#include <vector>
+
+namespace cppurses {
+class Size_policy;
+namespace detail {
+
+/// One length's claim on space being handed out by share_space().
+struct Share {
+    /// Relative size of this Share's portion, compared to the other Shares.
+    double weight;
+
+    /// Most space this Share can take.
+    std::size_t capacity;
+
+    /// Space given to this Share, the output of share_space().
+    std::size_t amount;
+};
+
+/// Split \p space among \p shares in proportion to weight, up to capacity.
+/** Space a full Share cannot take goes to the others, still in proportion to
+ *  weight. Shares are sorted by capacity over weight once, so this is
+ *  O(n log n) rather than a pass for each Share that fills. Amounts are whole
+ *  numbers that add up to exactly the space handed out, the remainders left by
+ *  rounding down go to the largest fractional parts, earlier Shares win ties.
+ *  Zero weight Shares only get space if no Share has a weight. Returns the
+ *  space left over, which is only non-zero if every Share is full. */
+std::size_t share_space(std::vector<Share>& shares, std::size_t space);
+
+/// A Widget's length along the axis being laid out, and its policy there.
+struct Policy_length {
+    const Size_policy* policy;
+    std::size_t* length;
+};
+
+/// Grow \p lengths into \p space, up to each max_size().
+/** Expanding and MinimumExpanding lengths grow first, by stretch, then
+ *  Preferred, Minimum and Ignored. Returns the space no length could take. */
+std::size_t grow_lengths(const std::vector<Policy_length>& lengths,
+                         std::size_t space);
+
+/// Shrink \p lengths by a total of \p excess, down to each min_size().
+/** Maximum, Preferred and Ignored lengths shrink first, Expanding after. A
+ *  larger stretch shrinks less, portions go by the inverse of stretch.
+ *  Returns the excess that could not be removed. */
+std::size_t shrink_lengths(const std::vector<Policy_length>& lengths,
+                           std::size_t excess);
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_DETAIL_SHARE_SPACE_HPP
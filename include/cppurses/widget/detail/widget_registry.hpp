@@ -0,0 +1,75 @@
+#ifndef CPPURSES_WIDGET_DETAIL_WIDGET_REGISTRY_HPP
+#define CPPURSES_WIDGET_DETAIL_WIDGET_REGISTRY_HPP
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace cppurses {
+class Widget;
+namespace detail {
+
+/// Global map from Widget::unique_id() to the living Widget with that ID.
+/** IDs come from a lock-free 64 bit counter and are never reused, so once a
+ *  Widget is destroyed and removed, its ID stays dead for the rest of the
+ *  program. Lookups of a dead ID find nothing, which lets other threads hold
+ *  on to an ID where holding a Widget* could dangle. Named Widgets are also
+ *  indexed by name, for Widget::find_descendant(). */
+class Widget_registry {
+   public:
+    /// Return a new ID, never returned before. Safe from any thread.
+    static std::uint64_t next_id();
+
+    /// Make \p w findable by its unique_id(), and by its name if it has one.
+    static void add(Widget& w);
+
+    /// Tombstone the ID of \p w, it will no longer be found.
+    static void remove(const Widget& w);
+
+    /// Move \p w in the name index from \p old_name to its current name.
+    static void rename(Widget& w, const std::string& old_name);
+
+    /// Return the living Widget with \p id, or nullptr if there is none.
+    /** The returned pointer is only safe to use on the thread that owns the
+     *  Widget tree, use visit() from other threads. */
+    static Widget* find(std::uint64_t id);
+
+    /// Call \p f with the Widget of \p id, if it is still alive.
+    /** The Widget can't be destroyed while \p f runs, \p f must not create or
+     *  destroy Widgets. Return true if \p f was called. */
+    template <typename Function>
+    static bool visit(std::uint64_t id, Function&& f) {
+        std::lock_guard<std::mutex> lock{mutex()};
+        auto at = widgets().find(id);
+        if (at == widgets().end()) {
+            return false;
+        }
+        std::forward<Function>(f)(*at->second);
+        return true;
+    }
+
+    /// Call \p f with each living Widget named \p name, in no set order.
+    /** Widgets without a name are not indexed, an empty \p name finds none.
+     *  \p f must not create, destroy or rename Widgets. */
+    template <typename Function>
+    static void for_each_named(const std::string& name, Function&& f) {
+        std::lock_guard<std::mutex> lock{mutex()};
+        auto range = names().equal_range(name);
+        for (auto at = range.first; at != range.second; ++at) {
+            f(*at->second);
+        }
+    }
+
+   private:
+    static std::mutex& mutex();
+    static std::unordered_map<std::uint64_t, Widget*>& widgets();
+    static std::unordered_multimap<std::string, Widget*>& names();
+
+    /// Erase the \p name entry of \p w, the mutex must be held.
+    static void erase_name(const std::string& name, const Widget& w);
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_DETAIL_WIDGET_REGISTRY_HPP
@@ -1,9 +1,13 @@
 #ifndef CPPURSES_WIDGET_LAYOUT_HPP
 #define CPPURSES_WIDGET_LAYOUT_HPP
 #include <cstddef>
+#include <unordered_map>
+#include <vector>
 
 #include <cppurses/painter/color.hpp>
+#include <cppurses/widget/area.hpp>
 #include <cppurses/widget/point.hpp>
+#include <cppurses/widget/size_policy.hpp>
 #include <cppurses/widget/widget.hpp>
 
 namespace cppurses {
@@ -39,6 +43,7 @@ class Layout : public Widget {
     }
 
     bool child_removed_event(Widget& child) override {
+        placed_.erase(&child);
         this->update_geometry();
         return Widget::child_removed_event(child);
     }
@@ -48,6 +53,14 @@ class Layout : public Widget {
         return Widget::child_polished_event(child);
     }
 
+    /// Move and Resize events posted to disabled children are dropped, so
+    /// what place() and save_inputs() remember may never have arrived.
+    bool disable_event() override {
+        this->forget_inputs();
+        placed_.clear();
+        return Widget::disable_event();
+    }
+
     struct Dimensions {
         Widget* widget;
         std::size_t width;
@@ -59,6 +72,56 @@ class Layout : public Widget {
         std::size_t* width;
         std::size_t* height;
     };
+
+    /// Return true if nothing a layout depends on changed since save_inputs().
+    /** Compares the inner position and size of this Layout, and the order,
+     *  enabled state and Size_policies of each child. If true, the children
+     *  are already where the last layout pass put them. */
+    bool inputs_unchanged() const;
+
+    /// Return true if no child changed since save_inputs().
+    /** The part of inputs_unchanged() that ignores this Layout's geometry, so
+     *  work that depends only on the children can be kept when it moves or is
+     *  resized. */
+    bool children_unchanged() const;
+
+    /// Remember the current inputs, call at the end of update_geometry().
+    void save_inputs();
+
+    /// Make the next update_geometry() a full pass.
+    /** For settings of a derived Layout that inputs_unchanged() can't see. */
+    void forget_inputs();
+
+    /// Post Move and Resize events to put \p child at \p position and \p size.
+    /** Events that would not change what was last posted are skipped. A Resize
+     *  is always posted to a child with children of its own, since enabling
+     *  this Layout can enable descendants that it has to lay out again. */
+    void place(Widget& child, Point position, Area size);
+
+    /// Disable \p child, there is not enough space to display it.
+    void hide(Widget& child);
+
+   private:
+    /// What a child contributes to the inputs of a layout pass.
+    struct Child_inputs {
+        const Widget* widget;
+        bool enabled;
+        Size_policy width_policy;
+        Size_policy height_policy;
+    };
+
+    /// Inputs as of the last save_inputs(), in child order.
+    std::vector<Child_inputs> inputs_;
+    Point inner_position_;
+    Area inner_size_{0, 0};
+    bool inputs_saved_{false};
+
+    /// Geometry last posted to each child, by place().
+    struct Placement {
+        Point position;
+        Area size;
+    };
+    std::unordered_map<const Widget*, Placement> placed_;
 };
 
 }  // namespace layout
@@ -0,0 +1,41 @@
+#ifndef CPPURSES_WIDGET_LAYOUT_BATCH_HPP
+#define CPPURSES_WIDGET_LAYOUT_BATCH_HPP
+
+namespace cppurses {
+class Widget;
+
+/// Scope that merges the geometry notifications sent to a parent Widget.
+/** Each Size_policy setter, and enabling or disabling a child, posts a
+ *  Child_polished_event to the parent, and each one is a layout pass.
+ *  While a Layout_batch for \p parent is alive those Events are held back,
+ *  commit() or the destructor posts a single Child_polished_event, and only
+ *  if something changed. Batches can nest, an inner batch for the same parent
+ *  hands its notification to the outer one. Not thread safe, batches only
+ *  hold back notifications made on the thread that created them. */
+class Layout_batch {
+   public:
+    /// Begin holding back notifications sent to \p parent.
+    explicit Layout_batch(Widget& parent);
+
+    Layout_batch(const Layout_batch&) = delete;
+    Layout_batch& operator=(const Layout_batch&) = delete;
+
+    /// Calls commit() if it has not been called already.
+    ~Layout_batch();
+
+    /// Stop holding back notifications, post the one that was held, if any.
+    /** If the last child to notify has been removed from the parent no Event
+     *  is posted, removing it already triggered a layout pass. */
+    void commit();
+
+    /// Post a Child_polished_event to \p parent, unless a batch holds it.
+    static void notify(Widget& parent, Widget& child);
+
+   private:
+    Widget& parent_;
+    Widget* pending_child_{nullptr};
+    bool committed_{false};
+};
+
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_LAYOUT_BATCH_HPP
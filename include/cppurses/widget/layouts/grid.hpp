@@ -0,0 +1,66 @@
+#ifndef CPPURSES_WIDGET_LAYOUTS_GRID_HPP
+#define CPPURSES_WIDGET_LAYOUTS_GRID_HPP
+#include <cstddef>
+#include <vector>
+
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/layout.hpp>
+#include <cppurses/widget/size_policy.hpp>
+
+namespace cppurses {
+class Widget;
+namespace layout {
+
+/// Arranges children in rows and columns, in a single layout pass.
+/** Children fill the cells in order, left to right, then top to bottom. Each
+ *  column is sized by a Size_policy merged from the width_policy of its
+ *  cells, and each row from their height_policy, the space is then shared
+ *  between the tracks the way Vertical and Horizontal share it between
+ *  children. A child sits at the top left of its cell, no larger than its own
+ *  maximum. Merged track policies are kept until a child changes, and track
+ *  sizes until the Grid is resized, so a pass is O(rows + columns + children)
+ *  and replaces one nested Layout per row. */
+class Grid : public Layout {
+   public:
+    /// Construct a Grid with \p columns columns, at least one.
+    explicit Grid(std::size_t columns = 1);
+
+    /// Set the number of columns, at least one, and lay out again.
+    void set_columns(std::size_t columns);
+
+    /// Return the number of columns children are arranged in.
+    std::size_t columns() const { return columns_; }
+
+    /// Return the number of rows needed for the current children.
+    std::size_t rows() const;
+
+   protected:
+    void update_geometry() override;
+
+   private:
+    std::size_t columns_;
+
+    /// Merged Size_policies, cached until a child changes.
+    std::vector<Size_policy> column_policies_;
+    std::vector<Size_policy> row_policies_;
+    bool policies_valid_{false};
+
+    /// Track lengths, cached until the policies or the Grid's size change.
+    std::vector<std::size_t> column_widths_;
+    std::vector<std::size_t> row_heights_;
+    Area sized_for_{0, 0};
+    bool sizes_valid_{false};
+
+    /// Merge the policies of the children into one for each track.
+    void merge_policies();
+
+    /// Share the width and height of the Grid between the tracks.
+    void size_tracks();
+
+    /// Post Move and Resize events to place each child in its cell.
+    void place_children();
+};
+
+}  // namespace layout
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_LAYOUTS_GRID_HPP
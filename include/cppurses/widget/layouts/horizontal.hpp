@@ -17,12 +17,11 @@ class Horizontal : public Layout {
     std::vector<Dimensions> calculate_widget_sizes();
     void move_and_resize_children(const std::vector<Dimensions>& dimensions);
 
-    void distribute_space(std::vector<Dimensions_reference> widgets,
+    void distribute_space(const std::vector<Dimensions_reference>& widgets,
                           int width_left);
 
-    void collect_space(std::vector<Dimensions_reference> widgets,
+    void collect_space(const std::vector<Dimensions_reference>& widgets,
                        int width_left);
-    // void collect_space(std::vector<Dimensions>& widgets, int width_left);
 };
 
 }  // namespace layout
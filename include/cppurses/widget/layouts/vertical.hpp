@@ -17,10 +17,10 @@ class Vertical : public layout::Layout {
     std::vector<Dimensions> calculate_widget_sizes();
     void move_and_resize_children(const std::vector<Dimensions>& dimensions);
 
-    void distribute_space(std::vector<Dimensions_reference> widgets,
+    void distribute_space(const std::vector<Dimensions_reference>& widgets,
                           int height_left);
 
-    void collect_space(std::vector<Dimensions_reference> widgets,
+    void collect_space(const std::vector<Dimensions_reference>& widgets,
                        int height_left);
 };
 
@@ -29,7 +29,9 @@ class Size_policy {
 
     /// Constructs a size policy with \p owner.
     /** \p owner is needed to notify its parent whenever a value has been
-     *  changed, this is done by posting a Child_polished_event. */
+     *  changed, this is done by posting a Child_polished_event. A
+     *  Layout_batch on the parent merges the Events of several changes. A
+     *  nullptr \p owner notifies no one, for policies a Layout uses itself. */
     explicit Size_policy(Widget* owner) : owner_{owner} {}
 
     /// Set the type to Fixed with size hint of \p hint.
@@ -133,9 +135,21 @@ class Size_policy {
     std::size_t max_{std::numeric_limits<std::size_t>::max()};
     Widget* owner_;
 
-    /// Post a Child_polished_event to the parent of owner_.
+    /// Post a Child_polished_event to the parent of owner_, or batch it.
     void notify_parent() const;
 };
 
+/// Return true if \p lhs and \p rhs would size a Widget the same way.
+/** The owners are not compared. */
+inline bool operator==(const Size_policy& lhs, const Size_policy& rhs) {
+    return lhs.type() == rhs.type() && lhs.stretch() == rhs.stretch() &&
+           lhs.hint() == rhs.hint() && lhs.min_size() == rhs.min_size() &&
+           lhs.max_size() == rhs.max_size();
+}
+
+inline bool operator!=(const Size_policy& lhs, const Size_policy& rhs) {
+    return !(lhs == rhs);
+}
+
 }  // namespace cppurses
 #endif  // CPPURSES_WIDGET_SIZE_POLICY_HPP
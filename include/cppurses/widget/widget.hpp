@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <set>
 #include <string>
@@ -23,12 +24,14 @@
 #include <cppurses/widget/children_data.hpp>
 #include <cppurses/widget/cursor_data.hpp>
 #include <cppurses/widget/detail/border_offset.hpp>
+#include <cppurses/widget/detail/widget_registry.hpp>
 #include <cppurses/widget/focus_policy.hpp>
 #include <cppurses/widget/point.hpp>
 #include <cppurses/widget/size_policy.hpp>
 
 namespace cppurses {
 struct Area;
+class Glyph_string;
 
 class Widget {
    public:
@@ -42,10 +45,11 @@ class Widget {
     virtual ~Widget();
 
     /// Return the name of the Widget.
-    std::string name() const { return name_; }
+    const std::string& name() const { return name_; }
 
     /// Return the ID number unique to this Widget.
-    std::uint16_t unique_id() const { return unique_id_; }
+    /** Never reused by another Widget, see detail::Widget_registry. */
+    std::uint64_t unique_id() const { return unique_id_; }
 
     /// Set the identifying name of the Widget.
     void set_name(std::string name);
@@ -96,30 +100,52 @@ class Widget {
     }
 
     /// Search children by name and Widget type.
-    /** Return a pointer to the given type, if found, or nullptr. */
+    /** Return a pointer to the given type, if found, or nullptr. Uses the
+     *  name index of children, in child order if several share \p name. */
     template <typename Widg_t = Widget>
     Widg_t* find_child(const std::string& name) const
     {
+        auto named = this->children.named(name);
+        if (named.first != named.second &&
+            std::next(named.first) == named.second) {
+            return dynamic_cast<Widg_t*>(named.first->second);
+        }
+        if (!name.empty() && named.first == named.second)
+            return nullptr;
         for (const std::unique_ptr<Widget>& widg : this->children.get()) {
-            if (widg->name() == name &&
-                dynamic_cast<Widg_t*>(widg.get()) != nullptr) {
-                return widg.get();
+            if (widg->name() == name) {
+                auto* found = dynamic_cast<Widg_t*>(widg.get());
+                if (found != nullptr)
+                    return found;
             }
         }
         return nullptr;
     }
 
     /// Search matching on \p name and Widg_t type for a descendant Widget.
-    /** Search with breadth first ordering over the 'Widget tree'. Return a
-     *  Widg_t* if found, otherwise a nullptr is returned. Return the first
-     *  matching descendant. */
+    /** Return a Widg_t* if found, otherwise a nullptr is returned. Candidates
+     *  come from the global name index, each checked in O(depth). If several
+     *  match, the first in breadth first order over the 'Widget tree' is
+     *  returned. */
     template <typename Widg_t = Widget>
     Widg_t* find_descendant(const std::string& name) const
     {
+        Widg_t* match{nullptr};
+        std::size_t match_count{0};
+        detail::Widget_registry::for_each_named(name, [&](Widget& w) {
+            auto* typed = dynamic_cast<Widg_t*>(&w);
+            if (typed != nullptr && this->children.has_descendant(&w)) {
+                match = typed;
+                ++match_count;
+            }
+        });
+        if (!name.empty() && match_count < 2)
+            return match;
         for (Widget* widg : this->children.get_descendants()) {
-            if (widg->name() == name &&
-                dynamic_cast<Widg_t*>(widg != nullptr)) {
-                return widg;
+            if (widg->name() == name) {
+                auto* found = dynamic_cast<Widg_t*>(widg);
+                if (found != nullptr)
+                    return found;
             }
         }
         return nullptr;
@@ -327,6 +353,11 @@ class Widget {
     /// Handles Key::Release objects.
     virtual bool key_release_event(const Key::State& keyboard);
 
+    /// Handles Paste_event objects.
+    /** The default implementation sends each ASCII character of \p text to
+     *  key_press_event(), as if it had been typed. */
+    virtual bool paste_event(const Glyph_string& text);
+
     /// Handles Focus_in_event objects.
     virtual bool focus_in_event();
 
@@ -396,6 +427,9 @@ class Widget {
     virtual bool key_release_event_filter(Widget& receiver,
                                           const Key::State& keyboard);
 
+    /// Handles Paste_event objects filtered from other Widgets.
+    virtual bool paste_event_filter(Widget& receiver, const Glyph_string& text);
+
     /// Handles Focus_in_event objects filtered from other Widgets.
     virtual bool focus_in_event_filter(Widget& receiver);
 
@@ -421,7 +455,7 @@ class Widget {
 
    private:
     std::string name_;
-    const std::uint16_t unique_id_;
+    const std::uint64_t unique_id_;
     Widget* parent_{nullptr};
     bool enabled_{false};
     bool brush_paints_wallpaper_{true};
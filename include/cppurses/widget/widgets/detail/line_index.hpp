@@ -0,0 +1,71 @@
+#ifndef CPPURSES_WIDGET_WIDGETS_DETAIL_LINE_INDEX_HPP
+#define CPPURSES_WIDGET_WIDGETS_DETAIL_LINE_INDEX_HPP
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cppurses {
+namespace detail {
+
+/// Sparse index of line start offsets, built on a background thread.
+/** Only the offset of every stride'th line is stored, so memory is bounded
+ *  by the line count divided by stride. Finding any line scans forward at
+ *  most stride lines from the closest stored offset. */
+class Line_index {
+   public:
+    /// Number of lines between stored offsets.
+    static constexpr std::size_t stride = 1024;
+
+    Line_index() = default;
+    Line_index(const Line_index&) = delete;
+    Line_index& operator=(const Line_index&) = delete;
+
+    ~Line_index() { this->reset(); }
+
+    /// Start indexing the \p size bytes at \p data on a background thread.
+    /** \p data must stay valid until reset() is called or this is destroyed.
+     *  Any previous indexing is stopped first. */
+    void build(const char* data, std::size_t size);
+
+    /// Stop the background thread and forget the indexed text.
+    void reset();
+
+    /// Return the number of lines found so far, the total once complete().
+    std::size_t lines_found() const { return lines_found_; }
+
+    /// Return true once the whole text has been indexed.
+    bool complete() const { return complete_; }
+
+    /// A line number and the byte offset of its first character.
+    struct Line_start {
+        std::size_t line;
+        std::size_t offset;
+    };
+
+    /// Return the start of line \p line, or of the last line if past it.
+    /** Can be called while indexing is still running, lines past the indexed
+     *  part are found by scanning from the last stored offset. */
+    Line_start find(std::size_t line) const;
+
+   private:
+    const char* data_{nullptr};
+    std::size_t size_{0};
+
+    /// Offset of line i * stride at index i.
+    std::vector<std::size_t> checkpoints_;
+    mutable std::mutex mtx_;
+
+    std::atomic<std::size_t> lines_found_{0};
+    std::atomic<bool> complete_{false};
+    std::atomic<bool> stop_{false};
+    std::thread worker_;
+
+    /// Body of the background thread.
+    void scan();
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_WIDGETS_DETAIL_LINE_INDEX_HPP
@@ -0,0 +1,90 @@
+#ifndef CPPURSES_WIDGET_WIDGETS_DETAIL_LINE_STYLES_HPP
+#define CPPURSES_WIDGET_WIDGETS_DETAIL_LINE_STYLES_HPP
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cppurses/widget/widgets/highlighter.hpp>
+
+namespace cppurses {
+namespace detail {
+
+/// Caches the Highlighter Spans and lexer States of each display line.
+/** Kept parallel to a Text_display's lines. Edits mark the lines they replace
+ *  as changed, the lines after them keep their entries. Lines are styled
+ *  lazily, in order, from the first line not known to be up to date. A line
+ *  that has not changed and starts in the State it was styled from is not
+ *  highlighted again, so restyling stops where the States resynchronize. */
+class Line_styles {
+   public:
+    using Spans = std::vector<Highlighter::Span>;
+
+    /// Style lines with \p highlighter from now on, nullptr disables styling.
+    /** \p line_count is the current number of lines. */
+    void set_highlighter(std::unique_ptr<Highlighter> highlighter,
+                         std::size_t line_count);
+
+    /// Return the Highlighter in use, or nullptr.
+    Highlighter* highlighter() const { return highlighter_.get(); }
+
+    /// Return true if there is a Highlighter to style lines with.
+    bool active() const { return highlighter_ != nullptr; }
+
+    /// Forget every cached line, there are now \p line_count lines.
+    void reset(std::size_t line_count);
+
+    /// Lines [first, first + removed) were replaced by \p inserted new lines.
+    void replace(std::size_t first, std::size_t removed, std::size_t inserted);
+
+    /// The first \p count lines were removed.
+    void erase_front(std::size_t count);
+
+    /// Return the Spans of \p line, styling the lines before it if needed.
+    /** \p get_text(line, text) must assign the text of line to text, in the
+     *  form Highlighter::highlight() takes. Requires active(). */
+    template <typename Get_text_t>
+    const Spans& spans(std::size_t line, Get_text_t&& get_text);
+
+   private:
+    struct Line {
+        Highlighter::State start_state;
+        Highlighter::State end_state;
+        Spans spans;
+        bool changed;
+    };
+
+    std::unique_ptr<Highlighter> highlighter_;
+    std::deque<Line> lines_;
+
+    /// Lines before this one are styled and up to date.
+    std::size_t valid_{0};
+
+    /// Reused between calls to highlight().
+    std::wstring text_;
+};
+
+template <typename Get_text_t>
+auto Line_styles::spans(std::size_t line, Get_text_t&& get_text)
+    -> const Spans& {
+    for (; valid_ <= line; ++valid_) {
+        auto& entry = lines_[valid_];
+        const auto state =
+            valid_ == 0 ? Highlighter::State{0} : lines_[valid_ - 1].end_state;
+        if (entry.changed || entry.start_state != state) {
+            get_text(valid_, text_);
+            entry.spans.clear();
+            entry.end_state =
+                highlighter_->highlight(text_, state, entry.spans);
+            entry.start_state = state;
+            entry.changed = false;
+        }
+    }
+    return lines_[line].spans;
+}
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_WIDGETS_DETAIL_LINE_STYLES_HPP
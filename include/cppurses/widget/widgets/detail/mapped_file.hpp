@@ -0,0 +1,43 @@
+#ifndef CPPURSES_WIDGET_WIDGETS_DETAIL_MAPPED_FILE_HPP
+#define CPPURSES_WIDGET_WIDGETS_DETAIL_MAPPED_FILE_HPP
+#include <cstddef>
+#include <string>
+
+namespace cppurses {
+namespace detail {
+
+/// Read-only memory mapping of an entire file.
+/** Pages are loaded by the OS on first access, so opening is O(1) regardless
+ *  of file size and only the touched parts of the file use memory. */
+class Mapped_file {
+   public:
+    /// Construct with nothing mapped.
+    Mapped_file() = default;
+
+    /// Map \p filename, throws std::runtime_error if it cannot be mapped.
+    explicit Mapped_file(const std::string& filename);
+
+    Mapped_file(const Mapped_file&) = delete;
+    Mapped_file& operator=(const Mapped_file&) = delete;
+    Mapped_file(Mapped_file&& other);
+    Mapped_file& operator=(Mapped_file&& other);
+
+    ~Mapped_file() { this->close(); }
+
+    /// Unmap the file, if any.
+    void close();
+
+    /// Return a pointer to the first byte of the file, nullptr if empty.
+    const char* data() const { return data_; }
+
+    /// Return the size of the file in bytes.
+    std::size_t size() const { return size_; }
+
+   private:
+    const char* data_{nullptr};
+    std::size_t size_{0};
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_WIDGETS_DETAIL_MAPPED_FILE_HPP
@@ -0,0 +1,75 @@
+#ifndef CPPURSES_WIDGET_WIDGETS_DETAIL_TEXT_SEARCH_HPP
+#define CPPURSES_WIDGET_WIDGETS_DETAIL_TEXT_SEARCH_HPP
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <cppurses/painter/glyph_rope.hpp>
+#include <cppurses/painter/glyph_string.hpp>
+
+namespace cppurses {
+namespace detail {
+
+/// Finds and tracks each occurrence of a pattern in a Glyph_rope.
+/** Symbols are compared, Brushes are ignored. Uses Boyer-Moore-Horspool, so
+ *  most Glyphs are skipped rather than compared. Match starts are kept
+ *  sorted, and an edit only re-searches the Glyphs around it. */
+class Text_search {
+   public:
+    /// Find every occurrence of \p pattern in \p text.
+    /** If \p pattern extends the previous pattern, only the previous matches
+     *  are checked, as when a pattern is typed one Glyph at a time. An empty
+     *  pattern clears the search. */
+    void search(const Glyph_rope& text, const Glyph_string& pattern);
+
+    /// Search \p text again for the current pattern.
+    void refresh(const Glyph_rope& text);
+
+    /// Forget the pattern and all matches.
+    void clear();
+
+    /// Update matches after \p removed Glyphs at \p index became \p inserted.
+    /** \p text is the contents after the edit. */
+    void edit(const Glyph_rope& text,
+              std::size_t index,
+              std::size_t removed,
+              std::size_t inserted);
+
+    /// Update matches after the first \p count Glyphs were removed.
+    void erase_front(std::size_t count);
+
+    /// Return true if there is a pattern to search for.
+    bool active() const { return !pattern_.empty(); }
+
+    /// Return the length of the pattern.
+    std::size_t pattern_length() const { return pattern_.size(); }
+
+    /// Return the start index of each match, in increasing order.
+    const std::vector<std::size_t>& matches() const { return matches_; }
+
+    /// Return the position in matches() of the first match not before \p index.
+    /** That is the first match covering \p index, or else the first match
+     *  starting after it. Returns matches().size() if there is none. */
+    std::size_t first_reaching(std::size_t index) const;
+
+   private:
+    std::wstring pattern_;
+    std::vector<std::size_t> matches_;
+
+    /// Horspool shift for the last Glyph of a window, by low byte of symbol.
+    std::array<std::size_t, 256> shift_;
+
+    /// Fill shift_ from pattern_.
+    void build_shift_table();
+
+    /// Append to \p out the start of each match inside [first, last).
+    void find_all(const Glyph_rope& text,
+                  std::size_t first,
+                  std::size_t last,
+                  std::vector<std::size_t>& out) const;
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_WIDGETS_DETAIL_TEXT_SEARCH_HPP
@@ -70,6 +70,9 @@ class Textbox_base : public Text_display {
     /// Scroll to make the cursor visible if no longer on screen after resize.
     bool resize_event(Area new_size, Area old_size) override;
 
+    /// Scroll the match into view and move the cursor to its first Glyph.
+    void show_match(std::size_t index) override;
+
    private:
     /// Move the cursor one position to the right.
     void increment_cursor_right();
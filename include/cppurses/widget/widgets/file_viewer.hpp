@@ -0,0 +1,100 @@
+#ifndef CPPURSES_WIDGET_WIDGETS_FILE_VIEWER_HPP
+#define CPPURSES_WIDGET_WIDGETS_FILE_VIEWER_HPP
+#include <cstddef>
+#include <string>
+
+#include <cppurses/system/events/key.hpp>
+#include <cppurses/system/events/mouse.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/widgets/detail/line_index.hpp>
+#include <cppurses/widget/widgets/detail/mapped_file.hpp>
+#include <cppurses/widget/widgets/text_display.hpp>
+
+namespace cppurses {
+
+/// Read-only view of a file of any size.
+/** The file is memory mapped and its lines are indexed on a background
+ *  thread, so opening is immediate. Only the lines on screen are decoded
+ *  from UTF-8 into the Text_display contents, and scrolling moves relative
+ *  to the top line, so its cost does not depend on the size of the file.
+ *  Searches for line breaks look at most line_span() bytes ahead or back;
+ *  a longer line is broken there, at the start of a character, so long or
+ *  unbroken lines scroll in pieces at the same bounded cost. Each piece is
+ *  cut off after width * height characters. */
+class File_viewer : public Text_display {
+   public:
+    /// Construct with no file open.
+    File_viewer();
+
+    /// Open \p filename, throws std::runtime_error if it can't be opened.
+    explicit File_viewer(const std::string& filename);
+
+    /// Display \p filename from its first line, replacing any open file.
+    /** Throws std::runtime_error if the file can't be opened, the previous
+     *  file is closed either way. */
+    void open(const std::string& filename);
+
+    /// Close the file and clear the display.
+    void close();
+
+    /// Scroll up by \p n lines of the file.
+    void scroll_up(std::size_t n = 1) override;
+
+    /// Scroll down by \p n lines of the file, stops at the last line.
+    void scroll_down(std::size_t n = 1) override;
+
+    /// Display line number \p line of the file at the top.
+    /** Uses the line index, scanning at most Line_index::stride lines past
+     *  the nearest indexed line. Stops at the last line. */
+    void go_to_line(std::size_t line);
+
+    /// Return the line number of the file displayed at the top.
+    std::size_t top_file_line() const { return top_file_line_; }
+
+    /// Return the number of lines indexed so far.
+    /** The total number of lines in the file once index_complete(). */
+    std::size_t file_line_count() const { return index_.lines_found(); }
+
+    /// Return true once the background line indexing has finished.
+    bool index_complete() const { return index_.complete(); }
+
+    /// Return the size in bytes of the open file.
+    std::size_t file_size() const { return file_.size(); }
+
+   protected:
+    bool resize_event(Area new_size, Area old_size) override;
+    bool key_press_event(const Key::State& keyboard) override;
+    bool mouse_press_event(const Mouse::State& mouse) override;
+
+    using Text_display::append;
+    using Text_display::clear;
+    using Text_display::erase;
+    using Text_display::insert;
+    using Text_display::pop_back;
+    using Text_display::set_contents;
+
+   private:
+    // Declared first so the index stops reading before the file is unmapped.
+    detail::Mapped_file file_;
+    detail::Line_index index_;
+
+    std::size_t top_offset_{0};
+    std::size_t top_file_line_{0};
+
+    /// Decode the lines that fit on screen into the Text_display contents.
+    void show_lines();
+
+    /// Return the most bytes that one displayed line can take up.
+    std::size_t line_span() const;
+
+    /// Return the offset of the line starting before \p offset.
+    /** Looks back at most line_span() bytes, a longer line is broken there. */
+    std::size_t previous_line(std::size_t offset) const;
+
+    /// Return the offset of the line after the one starting at \p offset.
+    /** Looks at most line_span() bytes ahead, a longer line is broken there. */
+    std::size_t next_line(std::size_t offset) const;
+};
+
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_WIDGETS_FILE_VIEWER_HPP
@@ -0,0 +1,43 @@
+#ifndef CPPURSES_WIDGET_WIDGETS_HIGHLIGHTER_HPP
+#define CPPURSES_WIDGET_WIDGETS_HIGHLIGHTER_HPP
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <cppurses/painter/brush.hpp>
+
+namespace cppurses {
+
+/// Computes the styles of a Text_display's contents, one line at a time.
+/** Styles are applied when the text is painted, Glyphs are not modified. The
+ *  lexer state at the end of each display line is cached, so after an edit
+ *  only the lines from the edit until the state matches again are restyled.
+ *  highlight() must depend only on its arguments. */
+class Highlighter {
+   public:
+    /// Lexer state carried from one line to the next, 0 starts the text.
+    /** Opaque to Text_display, e.g. an enum of 'in a block comment', etc. */
+    using State = std::size_t;
+
+    /// Style \p length Glyphs starting at \p offset within a line.
+    struct Span {
+        std::size_t offset;
+        std::size_t length;
+        Brush brush;
+    };
+
+    virtual ~Highlighter() = default;
+
+    /// Append the Spans of \p line to \p spans, return the State after it.
+    /** \p line holds the symbols of one display line, and its trailing '\n'
+     *  if it ends a line of the text, so a wrapped line can be told apart.
+     *  \p state is the State returned for the previous line. Spans must be
+     *  in order and must not overlap. The colors of a Span's Brush override
+     *  the Glyph's, match highlighting is painted over both. */
+    virtual State highlight(const std::wstring& line,
+                            State state,
+                            std::vector<Span>& spans) const = 0;
+};
+
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_WIDGETS_HIGHLIGHTER_HPP
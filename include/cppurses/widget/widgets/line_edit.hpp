@@ -63,6 +63,7 @@ class Line_edit : public Textbox {
    protected:
     bool key_press_event(const Key::State& keyboard) override;
     bool mouse_press_event(const Mouse::State& mouse) override;
+    bool paste_event(const Glyph_string& text) override;
     bool focus_in_event() override;
     auto paint_event() -> bool override;
 
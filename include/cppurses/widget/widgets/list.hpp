@@ -0,0 +1,133 @@
+#ifndef CPPURSES_WIDGET_WIDGETS_LIST_HPP
+#define CPPURSES_WIDGET_WIDGETS_LIST_HPP
+#include <cstddef>
+#include <vector>
+
+#include <signals/signal.hpp>
+#include <signals/slot.hpp>
+
+#include <cppurses/painter/attribute.hpp>
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/system/events/key.hpp>
+#include <cppurses/system/events/mouse.hpp>
+#include <cppurses/widget/widget.hpp>
+#include <cppurses/widget/widgets/list_source.hpp>
+
+namespace cppurses {
+class Painter;
+
+/// Scrollable list, or table with columns, of rows from a List_source.
+/** Only the rows in view are requested from the source and painted, and the
+ *  List is a single Widget, so the cost of painting and scrolling does not
+ *  depend on the number of rows. One row is selected, Arrow keys and Page
+ *  Up/Down move the selection, Enter or a click sends the selected Signal.
+ *  If any column has a heading it is displayed on the top line. */
+class List : public Widget {
+   public:
+    /// Construct with no source, nothing is displayed until set_source().
+    List();
+
+    /// Construct displaying the rows of \p source.
+    explicit List(const List_source& source);
+
+    /// Display the rows of \p source, which must outlive the List.
+    /** Scrolls to and selects the first row. nullptr clears the List. */
+    void set_source(const List_source* source);
+
+    /// Return the source currently displayed, or nullptr.
+    const List_source* source() const { return source_; }
+
+    /// Call after the source's rows change, repaints the List.
+    /** The selection and top row keep their indices, clamped to the new
+     *  size. */
+    void refresh();
+
+    /// Add a column \p width cells wide, with \p heading.
+    /** Cells are cut off one short of \p width, leaving a space between
+     *  columns. The last column takes the remaining width. With no columns
+     *  the first cell of each row takes the whole width. */
+    void add_column(Glyph_string heading, std::size_t width);
+
+    /// Remove every column.
+    void clear_columns();
+
+    /// Select row \p index, scrolling it into view if needed.
+    /** Clamped to the last row. Does not send the selected Signal. */
+    void select(std::size_t index);
+
+    /// Move the selection up by \p n rows, stops at the first row.
+    void select_up(std::size_t n = 1);
+
+    /// Move the selection down by \p n rows, stops at the last row.
+    void select_down(std::size_t n = 1);
+
+    /// Return the index of the selected row, 0 if there are no rows.
+    std::size_t selected_index() const { return selected_; }
+
+    /// Scroll the view up by \p n rows, the selection does not move.
+    void scroll_up(std::size_t n = 1);
+
+    /// Scroll the view down by \p n rows, stops when the last row is shown.
+    void scroll_down(std::size_t n = 1);
+
+    /// Return the index of the row displayed at the top.
+    std::size_t top_index() const { return top_; }
+
+    /// Return the number of rows that fit below the headings.
+    std::size_t visible_rows() const;
+
+    /// Set the Attribute applied to the selected row.
+    void set_selected_attribute(const Attribute& attr);
+
+    /// Sent with the index of the selected row on Enter or click.
+    sig::Signal<void(std::size_t index)> selected;
+
+    /// Sent with the new index whenever the selection moves.
+    sig::Signal<void(std::size_t index)> selection_changed;
+
+   protected:
+    bool paint_event() override;
+    bool key_press_event(const Key::State& keyboard) override;
+    bool mouse_press_event(const Mouse::State& mouse) override;
+
+   private:
+    struct Column {
+        Glyph_string heading;
+        std::size_t width;
+    };
+
+    const List_source* source_{nullptr};
+    std::vector<Column> columns_;
+    std::size_t top_{0};
+    std::size_t selected_{0};
+    Attribute selected_attr_{Attribute::Inverse};
+
+    /// Reused for each row painted.
+    std::vector<Glyph_string> cells_;
+
+    /// Return the number of rows in the source, 0 if there is none.
+    std::size_t row_count() const;
+
+    /// Return true if any column has a heading to display.
+    bool has_headings() const;
+
+    /// Return the largest top row index that still fills the view.
+    std::size_t max_top() const;
+
+    /// Paint \p cells on line \p y, one for each column.
+    void paint_cells(Painter& p,
+                     const std::vector<Glyph_string>& cells,
+                     std::size_t y,
+                     bool highlight);
+};
+
+namespace slot {
+
+sig::Slot<void(std::size_t)> select(List& list);
+sig::Slot<void()> select(List& list, std::size_t index);
+
+sig::Slot<void()> refresh(List& list);
+
+}  // namespace slot
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_WIDGETS_LIST_HPP
@@ -0,0 +1,29 @@
+#ifndef CPPURSES_WIDGET_WIDGETS_LIST_SOURCE_HPP
+#define CPPURSES_WIDGET_WIDGETS_LIST_SOURCE_HPP
+#include <cstddef>
+#include <vector>
+
+#include <cppurses/painter/glyph_string.hpp>
+
+namespace cppurses {
+
+/// Provides the rows displayed by a List, on demand.
+/** A List only asks for the rows it is about to paint, so the rows can live
+ *  anywhere, a container, a database cursor, or be computed from the index.
+ *  The source keeps its own data, a List never copies more than one row. */
+class List_source {
+   public:
+    virtual ~List_source() = default;
+
+    /// Return the number of rows.
+    virtual std::size_t size() const = 0;
+
+    /// Append the cells of row \p index to \p cells, one for each column.
+    /** \p index is less than size(). \p cells is empty when called, missing
+     *  cells are left blank and extra cells are not displayed. */
+    virtual void row(std::size_t index,
+                     std::vector<Glyph_string>& cells) const = 0;
+};
+
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_WIDGETS_LIST_SOURCE_HPP
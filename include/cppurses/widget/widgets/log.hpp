@@ -1,26 +1,112 @@
 #ifndef CPPURSES_WIDGET_WIDGETS_LOG_HPP
 #define CPPURSES_WIDGET_WIDGETS_LOG_HPP
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
 #include <signals/slot.hpp>
 
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/system/detail/mpsc_queue.hpp>
 #include <cppurses/system/events/key.hpp>
 #include <cppurses/widget/widgets/text_display.hpp>
 #include <cppurses/widget/widgets/textbox.hpp>
 
 namespace cppurses {
-class Glyph_string;
 
 class Log : public Textbox {
    public:
+    /// Used to indicate that there is no limit.
+    static const std::size_t npos = -1;
+
+    /// Counters for a single source of post_message_async() calls.
+    struct Source_stats {
+        std::size_t messages{0};
+        std::size_t glyphs{0};
+        /// Messages per second over the last window of at least one second.
+        double rate{0.0};
+    };
+
+    /// Append \p message on a new line and scroll to the bottom.
+    /** Only the new message is wrapped. If a limit is exceeded, the oldest
+     *  messages are evicted without reflowing the remaining messages. */
     void post_message(Glyph_string message);
 
+    /// Keep at most \p count messages, evicting the oldest. Default unlimited.
+    void set_max_messages(std::size_t count);
+
+    /// Return the maximum number of messages kept.
+    std::size_t max_messages() const { return max_messages_; }
+
+    /// Keep at most \p bytes of stored Glyphs, evicting the oldest messages.
+    /** Measured as sizeof(Glyph) per Glyph held. The newest message is always
+     *  kept. Unlimited by default. */
+    void set_max_bytes(std::size_t bytes);
+
+    /// Return the maximum number of bytes of stored Glyphs.
+    std::size_t max_bytes() const { return max_bytes_; }
+
+    /// Queue \p message to be posted from the main thread. Thread safe.
+    /** Lock-free, the contents are not touched by the calling thread. Messages
+     *  queued between two event loop iterations are appended together with a
+     *  single wrap and repaint. \p source identifies the caller in
+     *  source_stats(). The Log must outlive the call. */
+    void post_message_async(Glyph_string message, std::string source = "");
+
+    /// Post all messages queued by post_message_async(). Main thread only.
+    /** Called by the event loop once a batch of messages is waiting. */
+    void flush_async_messages();
+
+    /// Return counters for each source, updated by flush_async_messages().
+    const std::map<std::string, Source_stats>& source_stats() const {
+        return source_stats_;
+    }
+
    protected:
+    bool enable_event() override;
     bool key_press_event(const Key::State& keyboard) override;
+    bool paste_event(const Glyph_string& text) override;
 
     using Text_display::append;
     using Text_display::erase;
     using Text_display::insert;
     using Text_display::pop_back;
     using Text_display::set_contents;
+
+   private:
+    using Clock_t = std::chrono::steady_clock;
+
+    struct Pending_message {
+        Glyph_string message;
+        std::string source;
+    };
+
+    /// Messages counted toward the next Source_stats::rate update.
+    struct Rate_window {
+        Clock_t::time_point start;
+        std::size_t messages;
+    };
+
+    detail::Mpsc_queue<Pending_message> pending_;
+    std::map<std::string, Source_stats> source_stats_;
+    std::map<std::string, Rate_window> rate_windows_;
+
+    /// Glyph count of each message held, oldest first.
+    std::deque<std::size_t> message_lengths_;
+    std::size_t max_messages_{npos};
+    std::size_t max_bytes_{npos};
+
+    /// Append \p messages with a single reflow, then scroll to the bottom.
+    void post_messages(std::vector<Glyph_string>& messages);
+
+    /// Evict the oldest messages until within max_messages_ and max_bytes_.
+    void enforce_limits();
+
+    /// Count \p pending toward the stats of its source.
+    void record(const Pending_message& pending, Clock_t::time_point now);
 };
 
 namespace slot {
@@ -1,15 +1,24 @@
 #ifndef CPPURSES_WIDGET_WIDGETS_TEXT_DISPLAY_HPP
 #define CPPURSES_WIDGET_WIDGETS_TEXT_DISPLAY_HPP
 #include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include <signals/signal.hpp>
 
 #include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/color.hpp>
+#include <cppurses/painter/glyph_rope.hpp>
 #include <cppurses/painter/glyph_string.hpp>
 #include <cppurses/widget/widget.hpp>
+#include <cppurses/widget/widgets/detail/line_styles.hpp>
+#include <cppurses/widget/widgets/detail/text_search.hpp>
+#include <cppurses/widget/widgets/highlighter.hpp>
 
 namespace cppurses {
+class Painter;
 struct Point;
 
 /// Used to define the alignment of text in a Text_display Widget.
@@ -29,6 +38,10 @@ class Text_display : public Widget {
      *  the cursor at the first Glyph, or where the first Glyph would be. */
     void set_contents(Glyph_string text);
 
+    /// Replace the current contents with \p text, without copying Glyphs.
+    /** Can be used to restore a snapshot previously taken with text(). */
+    void set_contents(Glyph_rope text);
+
     /// Inserts \p text starting at \p index into the current contents.
     /** Applys insert_brush to each Glyph added. Index can be one past the
      *  current length of the contents, to append. No-op if index is larger than
@@ -96,18 +109,57 @@ class Text_display : public Widget {
      *  Glyph position to \p index that is displayed on screen. */
     Point display_position(std::size_t index) const;
 
-    /// Return the entire contents of the Text_display.
-    /** Provided as a non-const reference so contents can be modified without
-     *  limitation from the Text_display interface. Be sure to call
-     *  Text_display::update() after modifying the contents directly. */
-    Glyph_string& contents() { return contents_; }
+    /// Return a copy of the entire contents of the Text_display.
+    /** O(n), use text() to read the contents without copying them. */
+    Glyph_string contents() const { return contents_.glyph_string(); }
+
+    /// Return the contents as stored, a Glyph_rope.
+    /** Copying the returned Glyph_rope is O(1) and it is not affected by later
+     *  edits, so it can be kept as an undo snapshot. */
+    const Glyph_rope& text() const { return contents_; }
 
-    /// Return the entire contents of the Text_display.
-    const Glyph_string& contents() const { return contents_; }
+    /// Return the number of Glyphs in the contents.
+    std::size_t contents_size() const { return contents_.size(); }
 
     /// Return whether word wrapping is enabled.
     bool word_wrap_enabled() const { return word_wrap_enabled_; }
 
+    /// Highlight each occurrence of \p pattern, an empty pattern clears it.
+    /** Symbols are compared, Brushes are ignored. If \p pattern extends the
+     *  previous pattern only the previous matches are rechecked, so searching
+     *  while the pattern is typed stays cheap. Matches follow later edits. */
+    void find(const Glyph_string& pattern);
+
+    /// Select the match after the selected match and scroll it into view.
+    /** Wraps around to the first match, starts from the top line if nothing is
+     *  selected. Returns false if there are no matches. */
+    bool find_next();
+
+    /// Select the match before the selected match and scroll it into view.
+    /** Wraps around to the last match, starts from the top line if nothing is
+     *  selected. Returns false if there are no matches. */
+    bool find_previous();
+
+    /// Return the start index of each match of the find() pattern, in order.
+    const std::vector<std::size_t>& matches() const {
+        return search_.matches();
+    }
+
+    /// Return the start index of the selected match, or Glyph_string::npos.
+    std::size_t selected_match() const { return selected_match_; }
+
+    /// Imprinted on matches when painted, its colors override the Glyph's.
+    Brush match_brush{background(Color::Yellow), foreground(Color::Black)};
+
+    /// Style the contents with \p highlighter when painted, or stop if null.
+    /** Only the visible lines, and the lines before them not yet styled, are
+     *  highlighted. After an edit, lines are restyled from the edit until the
+     *  Highlighter's State resynchronizes. */
+    void set_highlighter(std::unique_ptr<Highlighter> highlighter);
+
+    /// Return the Highlighter in use, or nullptr if there is none.
+    Highlighter* highlighter() const { return styles_.highlighter(); }
+
     /// Emitted when text is scrolled up. Sends number of lines scrolled by.
     sig::Signal<void(std::size_t n)> scrolled_up;
 
@@ -115,16 +167,24 @@ class Text_display : public Widget {
     sig::Signal<void(std::size_t n)> scrolled_down;
 
     /// Emitted when contents are modified. Sends a reference to the contents.
-    sig::Signal<void(const Glyph_string&)> contents_modified;
+    sig::Signal<void(const Glyph_rope&)> contents_modified;
 
    protected:
     /// Add call to Text_display::update_display() before posting Paint_event.
+    /** The text is only reflowed if the width or word wrapping has changed, the
+     *  edit functions reflow just the lines they touch. */
     void update() override;
 
     /// Paint the portion of contents that is currently visible on screen.
+    /** Matches of find() are only looked up, and Highlighter styles are only
+     *  computed, for the visible lines. */
     bool paint_event() override;
 
+    /// Scroll the match starting at \p index into view.
+    virtual void show_match(std::size_t index);
+
     /// Return the line number that contains \p index.
+    /** Binary search over the line starts, O(log lines). */
     std::size_t line_at(std::size_t index) const;
 
     /// Return the line number that is being displayed at the top of the Widget.
@@ -153,27 +213,77 @@ class Text_display : public Widget {
     /// Return the index of the last Glyph in contents.
     /** Can give an incorrect result if contents is empty. */
     std::size_t end_index() const {
-        return this->contents().empty() ? 0 : this->contents().size() - 1;
+        return contents_.empty() ? 0 : contents_.size() - 1;
     }
 
     /// Recalculate the text layout via display_state_.
     /** This updates display_state_, depends on the Widget's dimensions, if word
-     *  wrap is enabled, and the contents.*/
+     *  wrap is enabled, and the contents. Lines before \p from_line are kept,
+     *  the rest are rewrapped. */
     void update_display(std::size_t from_line = 0);
 
+    /// Remove the first \p count Glyphs of the contents.
+    /** If \p count ends at the start of a line, e.g. just after a '\n', the
+     *  lines before it are dropped and the remaining lines are kept as they
+     *  are, without a reflow. */
+    void erase_front(std::size_t count);
+
    private:
     /// Provides a start index into contents and total length for a text line.
+    /** start_index is offset by base_index_, use start_of() to read it. */
     struct Line_info {
         std::size_t start_index;
         std::size_t length;
     };
 
-    std::vector<Line_info> display_state_{Line_info{0, 0}};
-    Glyph_string contents_;
+    std::deque<Line_info> display_state_{Line_info{0, 0}};
+    Glyph_rope contents_;
+
+    /// Added to every Line_info::start_index.
+    /** Lets erase_front() drop lines without shifting each remaining line. */
+    std::size_t base_index_{0};
+
+    /// Return the index into contents of the first Glyph of \p info.
+    std::size_t start_of(const Line_info& info) const {
+        return info.start_index - base_index_;
+    }
+
+    /// Width that display_state_ was last wrapped to.
+    std::size_t wrapped_width_{0};
+
+    /// True if display_state_ needs a full reflow.
+    bool display_dirty_{true};
+
+    /// Update display_state_ after an edit at \p index.
+    /** \p removed Glyphs at \p index were replaced by \p inserted Glyphs.
+     *  Rewraps from the first line that could depend on the edit, and stops
+     *  once a new line start lines up with an old line start past the edit,
+     *  the remaining lines are shifted rather than rewrapped. Does a full
+     *  update_display() instead if one is pending. */
+    void reflow(std::size_t index, std::size_t removed, std::size_t inserted);
 
     /// Index into display_state_.
     std::size_t top_line_{0};
 
+    detail::Text_search search_;
+    std::size_t selected_match_{Glyph_string::npos};
+
+    /// Highlighter Spans of each line in display_state_, and their States.
+    detail::Line_styles styles_;
+
+    /// Assign the symbols of \p line to \p text, as Highlighter takes them.
+    void line_text(std::size_t line, std::wstring& text) const;
+
+    /// Put \p count Glyphs of contents from \p index at (\p x, \p y).
+    /** If \p overlay is not null, it is imprinted on each Glyph, its colors
+     *  overriding the Glyph's. */
+    void paint_run(Painter& painter,
+                   std::size_t index,
+                   std::size_t count,
+                   std::size_t x,
+                   std::size_t y,
+                   const Brush* overlay = nullptr) const;
+
     bool word_wrap_enabled_{true};
     Alignment alignment_{Alignment::Left};
 };
@@ -53,6 +53,9 @@ class Textbox : public detail::Textbox_base {
     /// Move the cursor to the pressed, or nearest cell, that contains a Glyph.
     bool mouse_press_event(const Mouse::State& mouse) override;
 
+    /// Insert the pasted \p text at the cursor as a single edit.
+    bool paste_event(const Glyph_string& text) override;
+
    private:
     bool scroll_wheel_{true};
     bool takes_input_{true};
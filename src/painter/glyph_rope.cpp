@@ -0,0 +1,285 @@
+#include <cppurses/painter/glyph_rope.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/painter/glyph_string_view.hpp>
+
+namespace cppurses {
+namespace detail {
+
+/// Leaf if height is zero, holding Glyphs, otherwise holds two children.
+/** Internal nodes are AVL balanced by height. */
+struct Rope_node {
+    using Ptr = std::shared_ptr<const Rope_node>;
+
+    std::size_t size{0};
+    std::uint8_t height{0};
+    Ptr left;
+    Ptr right;
+    std::vector<Glyph> glyphs;
+};
+
+}  // namespace detail
+}  // namespace cppurses
+
+namespace {
+using namespace cppurses;
+using Node = detail::Rope_node;
+using Ptr  = Node::Ptr;
+
+/// Largest number of Glyphs held by a single leaf.
+constexpr auto max_leaf = std::size_t{512};
+
+auto size_of(const Ptr& node) -> std::size_t {
+    return node == nullptr ? 0 : node->size;
+}
+
+auto height_of(const Ptr& node) -> int {
+    return node == nullptr ? -1 : node->height;
+}
+
+template <typename Iter_t>
+auto make_leaf(Iter_t first, Iter_t last) -> Ptr {
+    auto leaf = std::make_shared<Node>();
+    leaf->glyphs.assign(first, last);
+    leaf->size = leaf->glyphs.size();
+    return leaf;
+}
+
+auto make_node(Ptr left, Ptr right) -> Ptr {
+    auto node = std::make_shared<Node>();
+    node->size = left->size + right->size;
+    node->height = static_cast<std::uint8_t>(
+        1 + std::max(left->height, right->height));
+    node->left = std::move(left);
+    node->right = std::move(right);
+    return node;
+}
+
+/// Restore the AVL property on a node whose children differ by up to two.
+auto balance(Ptr left, Ptr right) -> Ptr {
+    const auto diff = height_of(left) - height_of(right);
+    if (diff > 1) {
+        if (height_of(left->left) >= height_of(left->right)) {
+            return make_node(left->left, make_node(left->right, right));
+        }
+        return make_node(make_node(left->left, left->right->left),
+                         make_node(left->right->right, right));
+    }
+    if (diff < -1) {
+        if (height_of(right->right) >= height_of(right->left)) {
+            return make_node(make_node(left, right->left), right->right);
+        }
+        return make_node(make_node(left, right->left->left),
+                         make_node(right->left->right, right->right));
+    }
+    return make_node(std::move(left), std::move(right));
+}
+
+/// Concatenate two trees, O(log n).
+/** Adjacent leaves that fit in a single leaf are merged, so repeated small
+ *  edits do not fragment the text into many tiny leaves. */
+auto join(Ptr left, Ptr right) -> Ptr {
+    if (left == nullptr) {
+        return right;
+    }
+    if (right == nullptr) {
+        return left;
+    }
+    if (left->height == 0 && right->height == 0 &&
+        left->size + right->size <= max_leaf) {
+        auto leaf = std::make_shared<Node>();
+        leaf->glyphs.reserve(left->size + right->size);
+        leaf->glyphs = left->glyphs;
+        leaf->glyphs.insert(std::end(leaf->glyphs), std::begin(right->glyphs),
+                            std::end(right->glyphs));
+        leaf->size = leaf->glyphs.size();
+        return leaf;
+    }
+    // A leaf is carried down to the leaf it borders, to be merged if it fits.
+    if (left->height > right->height + 1 ||
+        (right->height == 0 && left->height != 0)) {
+        return balance(left->left, join(left->right, std::move(right)));
+    }
+    if (right->height > left->height + 1 ||
+        (left->height == 0 && right->height != 0)) {
+        return balance(join(std::move(left), right->left), right->right);
+    }
+    return make_node(std::move(left), std::move(right));
+}
+
+/// Split \p node into the first \p index Glyphs and the rest.
+auto split(const Ptr& node, std::size_t index) -> std::pair<Ptr, Ptr> {
+    if (node == nullptr) {
+        return {nullptr, nullptr};
+    }
+    if (index == 0) {
+        return {nullptr, node};
+    }
+    if (index >= node->size) {
+        return {node, nullptr};
+    }
+    if (node->height == 0) {
+        const auto middle = std::begin(node->glyphs) + index;
+        return {make_leaf(std::begin(node->glyphs), middle),
+                make_leaf(middle, std::end(node->glyphs))};
+    }
+    const auto left_size = node->left->size;
+    if (index < left_size) {
+        auto parts = split(node->left, index);
+        return {std::move(parts.first),
+                join(std::move(parts.second), node->right)};
+    }
+    auto parts = split(node->right, index - left_size);
+    return {join(node->left, std::move(parts.first)), std::move(parts.second)};
+}
+
+/// Build a balanced tree over [first, last), or nullptr if empty.
+template <typename Iter_t>
+auto build(Iter_t first, Iter_t last) -> Ptr {
+    const auto count = static_cast<std::size_t>(std::distance(first, last));
+    if (count == 0) {
+        return nullptr;
+    }
+    if (count <= max_leaf) {
+        return make_leaf(first, last);
+    }
+    // Split on a leaf boundary so leaves stay full.
+    const auto leaves = (count + max_leaf - 1) / max_leaf;
+    const auto middle = first + (leaves / 2) * max_leaf;
+    return make_node(build(first, middle), build(middle, last));
+}
+
+/// Find the leaf holding \p index, return its first Glyph and its range.
+auto find_leaf(const Node* node, std::size_t index)
+    -> std::pair<const Node*, std::size_t> {
+    auto leaf_begin = std::size_t{0};
+    while (node->height != 0) {
+        if (index < node->left->size) {
+            node = node->left.get();
+        } else {
+            index -= node->left->size;
+            leaf_begin += node->left->size;
+            node = node->right.get();
+        }
+    }
+    return {node, leaf_begin};
+}
+
+/// Append the Glyphs of \p node in [index, index + count) to \p out.
+void copy_range(const Node* node,
+                std::size_t index,
+                std::size_t count,
+                Glyph_string& out) {
+    if (count == 0) {
+        return;
+    }
+    if (node->height == 0) {
+        const auto first = std::begin(node->glyphs) + index;
+        out.insert(std::end(out), first, first + count);
+        return;
+    }
+    const auto left_size = node->left->size;
+    if (index < left_size) {
+        const auto left_count = std::min(count, left_size - index);
+        copy_range(node->left.get(), index, left_count, out);
+        copy_range(node->right.get(), 0, count - left_count, out);
+    } else {
+        copy_range(node->right.get(), index - left_size, count, out);
+    }
+}
+
+}  // namespace
+
+namespace cppurses {
+
+Glyph_rope::Glyph_rope(const Glyph_string& glyphs)
+    : root_{build(std::begin(glyphs), std::end(glyphs))} {}
+
+std::size_t Glyph_rope::size() const {
+    return size_of(root_);
+}
+
+const Glyph& Glyph_rope::operator[](std::size_t index) const {
+    const auto leaf = find_leaf(root_.get(), index);
+    return leaf.first->glyphs[index - leaf.second];
+}
+
+const Glyph& Glyph_rope::at(std::size_t index) const {
+    if (index >= this->size()) {
+        throw std::out_of_range{"Glyph_rope::at: index out of range."};
+    }
+    return (*this)[index];
+}
+
+void Glyph_rope::insert(std::size_t index, const Glyph_string& glyphs) {
+    if (index > this->size()) {
+        throw std::out_of_range{"Glyph_rope::insert: index out of range."};
+    }
+    if (glyphs.empty()) {
+        return;
+    }
+    auto parts = split(root_, index);
+    root_ = join(join(std::move(parts.first),
+                      build(std::begin(glyphs), std::end(glyphs))),
+                 std::move(parts.second));
+}
+
+void Glyph_rope::append(const Glyph_string& glyphs) {
+    this->insert(this->size(), glyphs);
+}
+
+void Glyph_rope::erase(std::size_t index, std::size_t count) {
+    if (index > this->size()) {
+        throw std::out_of_range{"Glyph_rope::erase: index out of range."};
+    }
+    count = std::min(count, this->size() - index);
+    if (count == 0) {
+        return;
+    }
+    auto head = split(root_, index);
+    auto tail = split(head.second, count);
+    root_ = join(std::move(head.first), std::move(tail.second));
+}
+
+Glyph_string Glyph_rope::substr(std::size_t index, std::size_t count) const {
+    if (index > this->size()) {
+        throw std::out_of_range{"Glyph_rope::substr: index out of range."};
+    }
+    count = std::min(count, this->size() - index);
+    auto result = Glyph_string{};
+    result.reserve(count);
+    if (root_ != nullptr) {
+        copy_range(root_.get(), index, count, result);
+    }
+    return result;
+}
+
+Glyph_string_view Glyph_rope::chunk_at(std::size_t index,
+                                       std::size_t count) const {
+    if (index >= this->size()) {
+        return {};
+    }
+    const auto leaf = find_leaf(root_.get(), index);
+    const auto offset = index - leaf.second;
+    return {leaf.first->glyphs.data() + offset,
+            std::min(count, leaf.first->size - offset)};
+}
+
+void Glyph_rope::const_iterator::seek() const {
+    const auto leaf = find_leaf(root_, index_);
+    chunk_ = leaf.first->glyphs.data();
+    chunk_begin_ = leaf.second;
+    chunk_size_ = leaf.first->size;
+}
+
+}  // namespace cppurses
@@ -1,5 +1,6 @@
 #include <cppurses/painter/painter.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <string>
 #include <unordered_map>
@@ -7,7 +8,7 @@
 #include <cppurses/painter/detail/is_paintable.hpp>
 #include <cppurses/painter/detail/screen_descriptor.hpp>
 #include <cppurses/painter/detail/staged_changes.hpp>
-#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/painter/glyph_string_view.hpp>
 #include <cppurses/system/event_loop.hpp>
 #include <cppurses/system/system.hpp>
 #include <cppurses/widget/border.hpp>
@@ -42,12 +43,15 @@ void Painter::put(const Glyph& tile, std::size_t x, std::size_t y)
     this->put_global(tile, x_global, y_global);
 }
 
-void Painter::put(const Glyph_string& text, std::size_t x, std::size_t y)
+void Painter::put(Glyph_string_view text, std::size_t x, std::size_t y)
 {
-    if (!is_paintable_)
+    if (!is_paintable_ || x >= inner_area_.width || y >= inner_area_.height)
         return;
-    for (const Glyph& g : text) {
-        this->put(g, x++, y);
+    const auto visible = std::min(text.size(), inner_area_.width - x);
+    auto x_global       = widget_.inner_x() + x;
+    const auto y_global = widget_.inner_y() + y;
+    for (const Glyph& g : text.substr(0, visible)) {
+        this->put_global(g, x_global++, y_global);
     }
 }
 
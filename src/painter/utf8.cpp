@@ -0,0 +1,208 @@
+#include <cppurses/painter/utility/utf8.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+using namespace cppurses;
+
+/// Widen the ASCII prefix of [first, last) into \p out, return its length.
+/** Stops at or a few bytes before the first non-ASCII byte. */
+std::size_t widen_ascii(const char* first, const char* last, wchar_t* out) {
+    const auto size = static_cast<std::size_t>(last - first);
+    auto count = std::size_t{0};
+#if defined(__SSE2__)
+    if (sizeof(wchar_t) == 4) {
+        const auto zero = _mm_setzero_si128();
+        for (; count + 16 <= size; count += 16) {
+            const auto bytes = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(first + count));
+            if (_mm_movemask_epi8(bytes) != 0) {
+                break;
+            }
+            const auto low = _mm_unpacklo_epi8(bytes, zero);
+            const auto high = _mm_unpackhi_epi8(bytes, zero);
+            auto* dest = reinterpret_cast<__m128i*>(out + count);
+            _mm_storeu_si128(dest, _mm_unpacklo_epi16(low, zero));
+            _mm_storeu_si128(dest + 1, _mm_unpackhi_epi16(low, zero));
+            _mm_storeu_si128(dest + 2, _mm_unpacklo_epi16(high, zero));
+            _mm_storeu_si128(dest + 3, _mm_unpackhi_epi16(high, zero));
+        }
+    }
+#endif
+    // Eight bytes are checked at once with a single word.
+    for (; count + 8 <= size; count += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, first + count, sizeof(word));
+        if ((word & 0x8080808080808080ULL) != 0) {
+            break;
+        }
+        for (auto i = std::size_t{0}; i < 8; ++i) {
+            out[count + i] = static_cast<wchar_t>(first[count + i]);
+        }
+    }
+    return count;
+}
+
+/// Narrow the ASCII prefix of [first, last) into \p out, return its length.
+/** Stops at or a few wchar_ts before the first non-ASCII value. */
+std::size_t narrow_ascii(const wchar_t* first, const wchar_t* last, char* out) {
+    const auto size = static_cast<std::size_t>(last - first);
+    auto count = std::size_t{0};
+#if defined(__SSE2__)
+    if (sizeof(wchar_t) == 4) {
+        const auto zero = _mm_setzero_si128();
+        const auto non_ascii = _mm_set1_epi32(~0x7F);
+        for (; count + 16 <= size; count += 16) {
+            const auto* src = reinterpret_cast<const __m128i*>(first + count);
+            const auto a = _mm_loadu_si128(src);
+            const auto b = _mm_loadu_si128(src + 1);
+            const auto c = _mm_loadu_si128(src + 2);
+            const auto d = _mm_loadu_si128(src + 3);
+            const auto all =
+                _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+            const auto high_bits = _mm_and_si128(all, non_ascii);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(high_bits, zero)) != 0xFFFF) {
+                break;
+            }
+            const auto bytes = _mm_packus_epi16(_mm_packs_epi32(a, b),
+                                                _mm_packs_epi32(c, d));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + count), bytes);
+        }
+    }
+#endif
+    for (; count + 8 <= size; count += 8) {
+        auto bits = std::uint32_t{0};
+        for (auto i = std::size_t{0}; i < 8; ++i) {
+            bits |= static_cast<std::uint32_t>(first[count + i]);
+        }
+        if ((bits & ~std::uint32_t{0x7F}) != 0) {
+            break;
+        }
+        for (auto i = std::size_t{0}; i < 8; ++i) {
+            out[count + i] = static_cast<char>(first[count + i]);
+        }
+    }
+    return count;
+}
+
+/// Return true if \p byte is a continuation byte within [low, high].
+bool is_continuation(unsigned char byte,
+                     unsigned char low = 0x80,
+                     unsigned char high = 0xBF) {
+    return byte >= low && byte <= high;
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace utility {
+
+std::size_t decode_utf8(const char* first, const char* last, wchar_t* out) {
+    wchar_t* const begin = out;
+    while (first != last) {
+        const auto ascii = widen_ascii(first, last, out);
+        first += ascii;
+        out += ascii;
+        if (first == last) {
+            break;
+        }
+        const auto lead = static_cast<unsigned char>(*first);
+        if (lead < 0x80) {
+            *out++ = static_cast<wchar_t>(lead);
+            ++first;
+            continue;
+        }
+        // Length of the sequence and the valid range of its second byte,
+        // which rules out overlong forms, surrogates and values past U+10FFFF.
+        auto length = 0;
+        auto low = static_cast<unsigned char>(0x80);
+        auto high = static_cast<unsigned char>(0xBF);
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            length = 2;
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            length = 3;
+            low = lead == 0xE0 ? 0xA0 : 0x80;
+            high = lead == 0xED ? 0x9F : 0xBF;
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            length = 4;
+            low = lead == 0xF0 ? 0x90 : 0x80;
+            high = lead == 0xF4 ? 0x8F : 0xBF;
+        }
+        // Count the bytes that form a valid start of the sequence.
+        const auto available = last - first;
+        auto matched = 1;
+        if (length != 0 && available > 1 &&
+            is_continuation(first[1], low, high)) {
+            matched = 2;
+            while (matched < length && matched < available &&
+                   is_continuation(first[matched])) {
+                ++matched;
+            }
+        }
+        // A truncated or broken sequence is replaced as a single unit.
+        if (matched != length) {
+            *out++ = replacement_character;
+            first += matched;
+            continue;
+        }
+        auto value = static_cast<std::uint32_t>(lead & (0x7F >> length));
+        for (auto i = 1; i < length; ++i) {
+            const auto byte = static_cast<unsigned char>(first[i]);
+            value = (value << 6) | (byte & 0x3F);
+        }
+        *out++ = static_cast<wchar_t>(value);
+        first += length;
+    }
+    return out - begin;
+}
+
+std::size_t encode_utf8(const wchar_t* first, const wchar_t* last, char* out) {
+    char* const begin = out;
+    while (first != last) {
+        const auto ascii = narrow_ascii(first, last, out);
+        first += ascii;
+        out += ascii;
+        if (first == last) {
+            break;
+        }
+        auto value = static_cast<std::uint32_t>(*first++);
+        if (value < 0x80) {
+            *out++ = static_cast<char>(value);
+            continue;
+        }
+        if (value < 0x800) {
+            *out++ = static_cast<char>(0xC0 | (value >> 6));
+            *out++ = static_cast<char>(0x80 | (value & 0x3F));
+            continue;
+        }
+        if ((value >= 0xD800 && value <= 0xDFFF) || value > 0x10FFFF) {
+            value = static_cast<std::uint32_t>(replacement_character);
+        }
+        if (value < 0x10000) {
+            *out++ = static_cast<char>(0xE0 | (value >> 12));
+        } else {
+            *out++ = static_cast<char>(0xF0 | (value >> 18));
+            *out++ = static_cast<char>(0x80 | ((value >> 12) & 0x3F));
+        }
+        *out++ = static_cast<char>(0x80 | ((value >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (value & 0x3F));
+    }
+    return out - begin;
+}
+
+std::wstring bytes_to_wchar(const std::string& bytes) {
+    auto result = std::wstring(bytes.size(), L'\0');
+    const auto* data = bytes.data();
+    result.resize(decode_utf8(data, data + bytes.size(), &result[0]));
+    return result;
+}
+
+}  // namespace utility
+}  // namespace cppurses
@@ -1,20 +1,22 @@
 #include <cppurses/painter/utility/wchar_to_bytes.hpp>
 
-#include <codecvt>
-#include <locale>
 #include <string>
 
+#include <cppurses/painter/utility/utf8.hpp>
+
 namespace cppurses {
 namespace utility {
 
 std::string wchar_to_bytes(wchar_t ch) {
-    std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
-    return converter.to_bytes(ch);
+    char bytes[4];
+    return std::string(bytes, encode_utf8(&ch, &ch + 1, bytes));
 }
 
 std::string wchar_to_bytes(std::wstring w_str) {
-    std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
-    return converter.to_bytes(w_str);
+    auto result = std::string(w_str.size() * 4, '\0');
+    const auto* data = w_str.data();
+    result.resize(encode_utf8(data, data + w_str.size(), &result[0]));
+    return result;
 }
 
 }  // namespace utility
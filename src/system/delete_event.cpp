@@ -12,7 +12,7 @@ bool Delete_event::send() const {
     if (removed_ == nullptr) {
         return result;
     }
-    for (Widget* w : removed_->children.get_descendants()) {
+    for (Widget* w : removed_->children.descendants()) {
         w->delete_event();
     }
     removed_.reset();
@@ -27,6 +27,7 @@ auto to_string(Event::Type type) -> std::string
         case Event::MouseMove: return "MouseMove";
         case Event::KeyPress: return "KeyPress";
         case Event::KeyRelease: return "KeyRelease";
+        case Event::Paste: return "Paste";
         case Event::FocusIn: return "FocusIn";
         case Event::FocusOut: return "FocusOut";
         case Event::Paint: return "Paint";
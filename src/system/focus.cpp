@@ -1,7 +1,7 @@
 #include <cppurses/system/focus.hpp>
 
-#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <memory>
 #include <utility>
@@ -27,48 +27,156 @@ bool is_click_focus_policy(Focus_policy policy)
     return policy == Focus_policy::Strong || policy == Focus_policy::Click;
 }
 
-const auto is_tab_focusable = [](const auto* widg) {
-    return widg->enabled() && is_tab_focus_policy(widg->focus_policy);
-};
+/// System::head() and its descendants in tab order, rebuilt when they change.
+/** Only a change to the shape of the head's subtree, or a new head, requires
+ *  a rebuild. Enabled state and Focus_policy are checked when Tab is pressed;
+ *  a disabled Widget is skipped along with its whole subtree in one step, so
+ *  hidden pages and rows cost nothing. The position of the focus Widget is
+ *  remembered between presses. */
+class Focus_chain {
+   public:
+    /// Return the first tab focusable Widget after \p from, or before it if
+    /// not \p forward, wrapping around. \p from if there is none.
+    Widget* step(Widget* from, bool forward)
+    {
+        this->refresh();
+        const auto start = this->position_of(from);
+        auto found       = forward ? this->find_forward(start + 1, size())
+                                   : this->find_backward(0, start);
+        if (found == npos) {
+            found = forward ? this->find_forward(0, start)
+                            : this->find_backward(start + 1, size());
+        }
+        if (found == npos)
+            return from;
+        position_ = found;
+        return entries_[found].widget;
+    }
 
-// Return a widg tree from System::head() if focus_widget is nullptr.
-auto gen_focus_front_widg_tree()
-{
-    auto widg_tree = System::head()->children.get_descendants();
-    widg_tree.insert(std::begin(widg_tree), System::head());
-    auto* const focus_widg = Focus::focus_widget();
-    if (focus_widg != nullptr) {
-        const auto begin = std::begin(widg_tree);
-        const auto end   = std::end(widg_tree);
-        const auto iter  = std::find(begin, end, focus_widg);
-        if (iter != end)
-            std::rotate(begin, iter, end);
+   private:
+    static constexpr auto npos = static_cast<std::size_t>(-1);
+
+    /// A Widget, the index one past its subtree, and the index of its parent.
+    struct Entry {
+        Widget* widget;
+        std::size_t end;
+        std::size_t parent;
+    };
+
+    std::vector<Entry> entries_;
+    const Widget* head_{nullptr};
+    std::uint64_t generation_{0};
+
+    /// Index in entries_ of the Widget last returned by step().
+    std::size_t position_{0};
+
+    std::size_t size() const { return entries_.size(); }
+
+    void refresh()
+    {
+        Widget* const head = System::head();
+        if (head == head_ && head != nullptr &&
+            head->children.subtree_generation() == generation_) {
+            return;
+        }
+        head_     = head;
+        position_ = 0;
+        entries_.clear();
+        if (head == nullptr)
+            return;
+        generation_ = head->children.subtree_generation();
+        this->append(*head, npos);
     }
-    return widg_tree;
-}
 
-Widget* next_tab_focus()
-{
-    if (System::head() == nullptr)
-        return nullptr;
-    const auto widg_tree  = gen_focus_front_widg_tree();
-    const auto begin      = std::next(std::begin(widg_tree));
-    const auto end        = std::end(widg_tree);
-    const auto next_focus = std::find_if(begin, end, is_tab_focusable);
-    return next_focus != end ? *next_focus : Focus::focus_widget();
-}
+    /// Append \p widg and its descendants in preorder.
+    void append(Widget& widg, std::size_t parent)
+    {
+        const auto index = entries_.size();
+        entries_.push_back(Entry{&widg, 0, parent});
+        for (const std::unique_ptr<Widget>& child : widg.children.get())
+            this->append(*child, index);
+        entries_[index].end = entries_.size();
+    }
+
+    /// Return the index of \p widg in entries_, or 0 if it isn't there.
+    /** Constant time when focus was last moved by Tab, otherwise linear. */
+    std::size_t position_of(const Widget* widg)
+    {
+        if (position_ < size() && entries_[position_].widget == widg)
+            return position_;
+        position_ = 0;
+        for (std::size_t i{0}; i < size(); ++i) {
+            if (entries_[i].widget == widg) {
+                position_ = i;
+                break;
+            }
+        }
+        return position_;
+    }
 
-Widget* previous_tab_focus()
+    /// Return the first focusable index in [first, last), or npos.
+    std::size_t find_forward(std::size_t first, std::size_t last) const
+    {
+        auto i = first;
+        while (i < last) {
+            const Widget& widg = *entries_[i].widget;
+            if (widg.enabled() && !is_tab_focus_policy(widg.focus_policy)) {
+                ++i;
+                continue;
+            }
+            const auto disabled = this->outermost_disabled(i);
+            if (disabled == npos)
+                return i;
+            i = entries_[disabled].end;  // Skip the rest of its subtree.
+        }
+        return npos;
+    }
+
+    /// Return the last focusable index in [first, last), or npos.
+    std::size_t find_backward(std::size_t first, std::size_t last) const
+    {
+        auto i = last;
+        while (i > first) {
+            --i;
+            const Widget& widg = *entries_[i].widget;
+            if (widg.enabled() && !is_tab_focus_policy(widg.focus_policy))
+                continue;
+            const auto disabled = this->outermost_disabled(i);
+            if (disabled == npos)
+                return i;
+            i = disabled;  // Skip the rest of its subtree.
+        }
+        return npos;
+    }
+
+    /// Return the index of the outermost disabled Widget among \p index and
+    /// its ancestors, or npos if they are all enabled. O(depth).
+    std::size_t outermost_disabled(std::size_t index) const
+    {
+        auto disabled = npos;
+        for (auto i = index; i != npos; i = entries_[i].parent) {
+            if (!entries_[i].widget->enabled())
+                disabled = i;
+        }
+        return disabled;
+    }
+};
+
+Focus_chain focus_chain;
+
+/// Return the first tab focusable Widget after the focus Widget, or before it
+/// if not \p forward, wrapping around. The focus Widget if there is none.
+Widget* find_tab_focus(bool forward)
 {
     if (System::head() == nullptr)
         return nullptr;
-    const auto widg_tree      = gen_focus_front_widg_tree();
-    const auto begin          = std::rbegin(widg_tree);
-    const auto end            = std::rend(widg_tree);
-    const auto previous_focus = std::find_if(begin, end, is_tab_focusable);
-    return previous_focus != end ? *previous_focus : Focus::focus_widget();
+    return focus_chain.step(Focus::focus_widget(), forward);
 }
 
+Widget* next_tab_focus() { return find_tab_focus(true); }
+
+Widget* previous_tab_focus() { return find_tab_focus(false); }
+
 }  // namespace
 
 namespace cppurses {
@@ -0,0 +1,52 @@
+#include <cppurses/system/input_replay.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <cppurses/system/event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/terminal/input.hpp>
+#include <cppurses/terminal/input_record.hpp>
+
+namespace cppurses {
+
+Input_replay::Input_replay(const std::string& filename, Speed speed)
+    : file_{filename, std::ios::binary}, speed_{speed}
+{
+    if (!file_.is_open() || !read_record_header(file_))
+        throw std::runtime_error{"Unable to open input recording file."};
+    has_next_                   = read_record(file_, next_);
+    last_batch_                 = Clock_t::now();
+    Event_loop::is_main_thread_ = true;
+}
+
+auto Input_replay::loop_function() -> bool
+{
+    if (!has_next_) {
+        this->exit(0);
+        return false;
+    }
+    if (speed_ == Speed::Original) {
+        std::this_thread::sleep_until(
+            last_batch_ + std::chrono::microseconds(next_.delay));
+    }
+    last_batch_ = Clock_t::now();
+    auto posted = false;
+    do {
+        auto event = input::make_event(next_);
+        if (event != nullptr) {
+            System::post_event(std::move(event));
+            posted = true;
+        }
+        ++replayed_;
+        has_next_ = read_record(file_, next_);
+    } while (has_next_ && next_.batched);
+    return posted;
+}
+
+}  // namespace cppurses
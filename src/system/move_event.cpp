@@ -20,6 +20,9 @@ bool Move_event::send() const {
         const Point old_position{receiver_.x(), receiver_.y()};
         receiver_.set_x(new_position_.x);
         receiver_.set_y(new_position_.y);
+        if (receiver_.parent() != nullptr) {
+            receiver_.parent()->children.hit_index().invalidate();
+        }
         return receiver_.move_event(new_position_, old_position);
     }
     return true;
@@ -0,0 +1,21 @@
+#include <cppurses/system/events/paste_event.hpp>
+
+#include <utility>
+
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/system/event.hpp>
+#include <cppurses/widget/widget.hpp>
+
+namespace cppurses {
+
+Paste_event::Paste_event(Widget& receiver, Glyph_string text)
+    : Input_event{Event::Paste, receiver}, text_{std::move(text)} {}
+
+bool Paste_event::send() const {
+    return receiver_.paste_event(text_);
+}
+
+bool Paste_event::filter_send(Widget& filter) const {
+    return filter.paste_event_filter(receiver_, text_);
+}
+}  // namespace cppurses
@@ -63,6 +63,9 @@ bool Resize_event::send() const {
     // Set receiver_ to new size.
     receiver_.outer_width_ = new_area_.width;
     receiver_.outer_height_ = new_area_.height;
+    if (receiver_.parent() != nullptr) {
+        receiver_.parent()->children.hit_index().invalidate();
+    }
 
     // Remove screen_state tiles if they are outside the new dimensions.
     auto iter = std::begin(receiver_.screen_state().tiles);
@@ -68,7 +68,9 @@ int System::run(Widget& head)
     return this->run();
 }
 
-int System::run()
+int System::run() { return this->run(user_input_loop_); }
+
+int System::run(Event_loop& main_loop)
 {
     if (System::head() == nullptr)
         return -1;
@@ -80,7 +82,7 @@ int System::run()
     terminal.initialize();
     System::post_event<Resize_event>(*System::head(),
                                      Area{terminal.width(), terminal.height()});
-    const auto exit_code = user_input_loop_.run();
+    const auto exit_code = main_loop.run();
     terminal.uninitialize();
     return exit_code;
 }
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <cppurses/system/event.hpp>
 #include <cppurses/system/system.hpp>
@@ -12,10 +13,11 @@ namespace detail {
 
 auto User_input_event_loop::loop_function() -> bool
 {
-    auto event = input::get();
-    if (event == nullptr)
+    auto events = input::get_pending();
+    if (events.empty())
         return false;
-    System::post_event(std::move(event));
+    for (auto& event : events)
+        System::post_event(std::move(event));
     return true;
 }
 
@@ -0,0 +1,227 @@
+#include <cppurses/terminal/headless_screen.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <cppurses/painter/attribute.hpp>
+#include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/color.hpp>
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/painter/glyph_matrix.hpp>
+#include <cppurses/terminal/input_record.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/point.hpp>
+
+namespace {
+using namespace cppurses;
+
+/// Return the number of decimal digits in \p value.
+auto digit_count(std::size_t value) -> std::size_t
+{
+    auto count = std::size_t{1};
+    while (value >= 10) {
+        value /= 10;
+        ++count;
+    }
+    return count;
+}
+
+/// Length of the UTF-8 encoding of \p symbol.
+auto utf8_length(wchar_t symbol) -> std::size_t
+{
+    const auto value = static_cast<std::uint32_t>(symbol);
+    if (value < 0x80)
+        return 1;
+    if (value < 0x800)
+        return 2;
+    if (value < 0x10000)
+        return 3;
+    return 4;
+}
+
+/// Length of "ESC [ row ; col H", positioning the cursor at \p x, \p y.
+auto cursor_sequence_length(std::size_t x, std::size_t y) -> std::size_t
+{
+    return 4 + digit_count(y + 1) + digit_count(x + 1);
+}
+
+/// Length of an SGR sequence that resets, then applies all of \p brush.
+/** "ESC [ 0", then ";N" for each Attribute, ";3N" or ";9N" for the
+ *  foreground and ";4N" or ";10N" for the background, terminated by 'm'. */
+auto sgr_sequence_length(const Brush& brush) -> std::size_t
+{
+    auto length = std::size_t{4};
+    for (Attribute attr : Attribute_list) {
+        if (brush.has_attribute(attr))
+            length += 2;
+    }
+    if (brush.foreground_color())
+        length += 3;
+    if (brush.background_color()) {
+        const auto bg =
+            static_cast<Underlying_color_t>(*brush.background_color());
+        length += (bg - detail::first_color_value) < 8 ? 3 : 4;
+    }
+    return length;
+}
+
+}  // namespace
+
+namespace cppurses {
+
+Headless_screen::Headless_screen(Area size)
+    : cells_{size.width, size.height}
+{}
+
+std::size_t Headless_screen::width() const
+{
+    std::lock_guard<std::mutex> lock{mtx_};
+    return cells_.width();
+}
+
+std::size_t Headless_screen::height() const
+{
+    std::lock_guard<std::mutex> lock{mtx_};
+    return cells_.height();
+}
+
+void Headless_screen::resize(Area size)
+{
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        cells_.resize(size.width, size.height);
+        written_cursor_ = Point{~std::size_t{0}, ~std::size_t{0}};
+    }
+    auto record = Input_record{};
+    record.kind = Input_record::Kind::Resize;
+    record.area = size;
+    this->inject(std::move(record));
+}
+
+Glyph_matrix Headless_screen::snapshot() const
+{
+    std::lock_guard<std::mutex> lock{mtx_};
+    return cells_;
+}
+
+Glyph Headless_screen::at(std::size_t x, std::size_t y) const
+{
+    std::lock_guard<std::mutex> lock{mtx_};
+    return cells_.at(x, y);
+}
+
+std::wstring Headless_screen::row(std::size_t y) const
+{
+    std::lock_guard<std::mutex> lock{mtx_};
+    auto symbols = std::wstring{};
+    symbols.reserve(cells_.width());
+    for (auto x = std::size_t{0}; x < cells_.width(); ++x) {
+        symbols.push_back(cells_.at(x, y).symbol);
+    }
+    return symbols;
+}
+
+auto Headless_screen::stats() const -> Stats
+{
+    std::lock_guard<std::mutex> lock{mtx_};
+    return stats_;
+}
+
+void Headless_screen::reset_stats()
+{
+    std::lock_guard<std::mutex> lock{mtx_};
+    stats_ = Stats{};
+}
+
+Point Headless_screen::cursor() const
+{
+    std::lock_guard<std::mutex> lock{mtx_};
+    return cursor_;
+}
+
+bool Headless_screen::cursor_visible() const
+{
+    std::lock_guard<std::mutex> lock{mtx_};
+    return cursor_visible_;
+}
+
+void Headless_screen::inject(Input_record record)
+{
+    {
+        std::lock_guard<std::mutex> lock{input_mtx_};
+        input_.push_back(std::move(record));
+    }
+    input_cv_.notify_one();
+}
+
+bool Headless_screen::next_input(Input_record& record,
+                                 std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock{input_mtx_};
+    if (!input_cv_.wait_for(lock, timeout, [this] { return !input_.empty(); }))
+        return false;
+    record = std::move(input_.front());
+    input_.pop_front();
+    return true;
+}
+
+bool Headless_screen::poll_input(Input_record& record,
+                                 bool (*accept)(const Input_record&))
+{
+    std::lock_guard<std::mutex> lock{input_mtx_};
+    if (input_.empty() || (accept != nullptr && !accept(input_.front())))
+        return false;
+    record = std::move(input_.front());
+    input_.pop_front();
+    return true;
+}
+
+void Headless_screen::move_cursor(std::size_t x, std::size_t y)
+{
+    std::lock_guard<std::mutex> lock{mtx_};
+    cursor_ = Point{x, y};
+}
+
+void Headless_screen::put(const Glyph& glyph)
+{
+    std::lock_guard<std::mutex> lock{mtx_};
+    if (cursor_.x >= cells_.width() || cursor_.y >= cells_.height())
+        return;
+    ++stats_.cells;
+    auto& cell = cells_(cursor_.x, cursor_.y);
+    if (cell != glyph) {
+        ++stats_.cells_changed;
+        cell = glyph;
+    }
+    if (written_cursor_ != cursor_)
+        stats_.bytes += cursor_sequence_length(cursor_.x, cursor_.y);
+    if (!has_written_brush_ || !(written_brush_ == glyph.brush)) {
+        stats_.bytes += sgr_sequence_length(glyph.brush);
+        written_brush_     = glyph.brush;
+        has_written_brush_ = true;
+    }
+    stats_.bytes += utf8_length(glyph.symbol);
+    if (++cursor_.x == cells_.width()) {
+        cursor_.x = 0;
+        ++cursor_.y;
+    }
+    written_cursor_ = cursor_;
+}
+
+void Headless_screen::refresh()
+{
+    std::lock_guard<std::mutex> lock{mtx_};
+    ++stats_.refreshes;
+}
+
+void Headless_screen::show_cursor(bool show)
+{
+    std::lock_guard<std::mutex> lock{mtx_};
+    cursor_visible_ = show;
+}
+
+}  // namespace cppurses
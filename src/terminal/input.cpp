@@ -1,19 +1,27 @@
 #include <cppurses/terminal/input.hpp>
 
 #include <cstddef>
+#include <cstdio>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <ncurses.h>
 
+#include <cppurses/painter/glyph_string.hpp>
 #include <cppurses/system/detail/find_widget_at.hpp>
 #include <cppurses/system/event.hpp>
 #include <cppurses/system/events/key.hpp>
 #include <cppurses/system/events/mouse.hpp>
+#include <cppurses/system/events/paste_event.hpp>
 #include <cppurses/system/events/resize_event.hpp>
 #include <cppurses/system/focus.hpp>
 #include <cppurses/system/shortcuts.hpp>
 #include <cppurses/system/system.hpp>
+#include <cppurses/terminal/headless_screen.hpp>
+#include <cppurses/terminal/input_record.hpp>
+#include <cppurses/terminal/input_recorder.hpp>
 #include <cppurses/widget/area.hpp>
 #include <cppurses/widget/point.hpp>
 #include <cppurses/widget/widget.hpp>
@@ -21,6 +29,20 @@
 namespace {
 using namespace cppurses;
 
+/// Key codes that the bracketed paste markers are registered as.
+constexpr auto paste_begin = KEY_MAX + 1;
+constexpr auto paste_end   = KEY_MAX + 2;
+
+/// Milliseconds to wait on the next byte of a paste before giving up on it.
+constexpr auto paste_timeout = 500;
+
+/// Upper bound on the input read by a single call to input::get_pending().
+/** Keeps continuous input from holding off painting indefinitely. */
+constexpr auto max_pending_input = std::size_t{4096};
+
+/// The mouse button currently held down, reported along with motion.
+auto held_button = Mouse::Button::None;
+
 /// Check if mouse_event is a button_mask type of event.
 template <typename Mask_t>
 auto is(Mask_t button_mask, const ::MEVENT& mouse_event) -> bool
@@ -35,8 +57,13 @@ auto extract_info(const ::MEVENT& mouse_event)
     auto type_button = std::make_pair(Event::None, Mouse::Button::None);
     auto& type       = type_button.first;
     auto& button     = type_button.second;
+    // Motion / Drag with the held button, or hover with Button::None
+    if (is(REPORT_MOUSE_POSITION, mouse_event)) {
+        type   = Event::MouseMove;
+        button = held_button;
+    }
     // Button 1 / Left Button
-    if (is(BUTTON1_PRESSED, mouse_event)) {
+    else if (is(BUTTON1_PRESSED, mouse_event)) {
         type   = Event::MouseButtonPress;
         button = Mouse::Button::Left;
     }
@@ -85,44 +112,125 @@ auto extract_info(const ::MEVENT& mouse_event)
     return type_button;
 }
 
-auto make_mouse_event() -> std::unique_ptr<Event>
+/// Return true if \p mouse_event is a motion report.
+auto is_motion(const ::MEVENT& mouse_event) -> bool
 {
-    auto mouse_event = ::MEVENT{};
-    if (::getmouse(&mouse_event) != OK)
-        return nullptr;
-    Widget* receiver = detail::find_widget_at(mouse_event.x, mouse_event.y);
-    if (receiver == nullptr)
-        return nullptr;
+    return is(REPORT_MOUSE_POSITION, mouse_event);
+}
 
-    // Coordinates
-    const auto global = Point{static_cast<std::size_t>(mouse_event.x),
-                              static_cast<std::size_t>(mouse_event.y)};
-    const auto local =
-        Point{global.x - receiver->inner_x(), global.y - receiver->inner_y()};
+/// Return true if \p input is a printable character or a UTF-8 byte.
+auto is_text(int input) -> bool
+{
+    return (input >= ' ' && input < Key::Backspace) ||
+           (input > Key::Backspace && input <= 0xFF);
+}
 
-    // Create Event
+/// Convert a mouse report from ncurses and track the held button.
+auto to_record(const ::MEVENT& mouse_event) -> Input_record
+{
     const auto type_button = extract_info(mouse_event);
     const auto type        = type_button.first;
     const auto button      = type_button.second;
-    if (type == Event::MouseButtonPress) {
-        return std::make_unique<Mouse::Press>(
-            *receiver, Mouse::State{button, global, local, mouse_event.id});
+    if (type == Event::MouseButtonPress && button != Mouse::Button::ScrollUp &&
+        button != Mouse::Button::ScrollDown) {
+        held_button = button;
     }
-    if (type == Event::MouseButtonRelease) {
-        return std::make_unique<Mouse::Release>(
-            *receiver, Mouse::State{button, global, local, mouse_event.id});
+    else if (type == Event::MouseButtonRelease) {
+        held_button = Mouse::Button::None;
     }
-    return nullptr;
+    auto record       = Input_record{};
+    record.kind       = Input_record::Kind::Mouse;
+    record.mouse_type = type;
+    record.button     = button;
+    record.position   = Point{static_cast<std::size_t>(mouse_event.x),
+                            static_cast<std::size_t>(mouse_event.y)};
+    record.device_id  = mouse_event.id;
+    return record;
 }
 
-auto make_resize_event() -> std::unique_ptr<Event>
+/// Read the remainder of a bracketed paste into \p record.
+/** Curses keypad translation is still active, so special key codes inside of
+ *  the pasted text are dropped. Line endings are normalized to '\n'. */
+auto read_paste(Input_record& record) -> bool
 {
-    Widget* const receiver = System::head();
-    if (receiver != nullptr) {
-        const auto width  = System::terminal.width();
-        const auto height = System::terminal.height();
-        return std::make_unique<Resize_event>(*receiver, Area{width, height});
+    record.kind   = Input_record::Kind::Paste;
+    auto after_cr = false;
+    ::timeout(paste_timeout);
+    for (auto input = ::getch(); input != paste_end && input != ERR;
+         input      = ::getch()) {
+        if (input > 0xFF)
+            continue;
+        if (input == '\n' && after_cr) {
+            after_cr = false;
+            continue;
+        }
+        after_cr = input == '\r';
+        record.text.push_back(after_cr ? '\n' : static_cast<char>(input));
+    }
+    ::timeout(System::terminal.refresh_rate().count());
+    return !record.text.empty();
+}
+
+/// Fill in \p record from \p input, a value returned by getch().
+/** Return false if \p input does not represent any user input. */
+auto to_record(int input, Input_record& record) -> bool
+{
+    switch (input) {
+        case ERR: return false;  // Timeout and no event.
+        case KEY_MOUSE: {
+            auto mouse_event = ::MEVENT{};
+            if (::getmouse(&mouse_event) != OK)
+                return false;
+            record = to_record(mouse_event);
+            return true;
+        }
+        case KEY_RESIZE:
+            record.kind = Input_record::Kind::Resize;
+            record.area = Area{System::terminal.width(),
+                               System::terminal.height()};
+            return true;
+        case paste_begin: return read_paste(record);
+        case paste_end: return false;  // End of a paste that timed out.
+        default:
+            record.kind = Input_record::Kind::Key;
+            record.key  = input;
+            return true;
     }
+}
+
+/// Log \p record if recording, then turn it into an Event.
+auto process(const Input_record& record) -> std::unique_ptr<Event>
+{
+    Input_recorder::record(record);
+    return input::make_event(record);
+}
+
+auto make_mouse_event(const Input_record& record) -> std::unique_ptr<Event>
+{
+    const auto& global = record.position;
+    Widget* receiver   = detail::find_widget_at(global.x, global.y);
+    if (receiver == nullptr)
+        return nullptr;
+    const auto local =
+        Point{global.x - receiver->inner_x(), global.y - receiver->inner_y()};
+    const auto state =
+        Mouse::State{record.button, global, local, record.device_id};
+    switch (record.mouse_type) {
+        case Event::MouseButtonPress:
+            return std::make_unique<Mouse::Press>(*receiver, state);
+        case Event::MouseButtonRelease:
+            return std::make_unique<Mouse::Release>(*receiver, state);
+        case Event::MouseMove:
+            return std::make_unique<Mouse::Move>(*receiver, state);
+        default: return nullptr;
+    }
+}
+
+auto make_resize_event(Area area) -> std::unique_ptr<Event>
+{
+    Widget* const receiver = System::head();
+    if (receiver != nullptr)
+        return std::make_unique<Resize_event>(*receiver, area);
     return nullptr;
 }
 
@@ -134,6 +242,49 @@ auto make_keyboard_event(int input) -> std::unique_ptr<Event>
     return receiver == nullptr ? nullptr
                                : std::make_unique<Key::Press>(*receiver, code);
 }
+
+auto make_paste_event(const std::string& text) -> std::unique_ptr<Event>
+{
+    Widget* const receiver = Focus::focus_widget();
+    if (receiver == nullptr)
+        return nullptr;
+    return std::make_unique<Paste_event>(*receiver, Glyph_string{text});
+}
+
+/// Return true if \p record can be read in the same batch as earlier input.
+/** Matches what get_pending() batches from the terminal, text and motion. */
+auto is_batchable(const Input_record& record) -> bool
+{
+    return (record.kind == Input_record::Kind::Key && is_text(record.key)) ||
+           (record.kind == Input_record::Kind::Mouse &&
+            record.mouse_type == Event::MouseMove);
+}
+
+/// get_pending() for a Headless_screen, reads injected records.
+auto get_pending_headless(Headless_screen& screen)
+    -> std::vector<std::unique_ptr<Event>>
+{
+    auto events = std::vector<std::unique_ptr<Event>>{};
+    auto record = Input_record{};
+    if (!screen.next_input(record, System::terminal.refresh_rate()))
+        return events;
+    auto count = std::size_t{0};
+    do {
+        record.batched = count != 0;
+        auto event     = process(record);
+        if (event != nullptr)
+            events.push_back(std::move(event));
+    } while (++count < max_pending_input &&
+             screen.poll_input(record, &is_batchable));
+    return events;
+}
+
+/// Write a DEC private mode set or reset sequence to the terminal.
+void set_private_mode(int mode, bool enable)
+{
+    std::printf("\033[?%d%c", mode, enable ? 'h' : 'l');
+    std::fflush(stdout);
+}
 }  // namespace
 
 namespace cppurses {
@@ -141,13 +292,105 @@ namespace input {
 
 auto get() -> std::unique_ptr<Event>
 {
-    const auto input = ::getch();
-    switch (input) {
-        case ERR: return nullptr;  // Timeout and no event.
-        case KEY_MOUSE: return make_mouse_event();
-        case KEY_RESIZE: return make_resize_event();
-        default: return make_keyboard_event(input);  // Key_event
+    auto record = Input_record{};
+    if (auto* headless = System::terminal.headless()) {
+        if (!headless->next_input(record, System::terminal.refresh_rate()))
+            return nullptr;
+        return process(record);
     }
+    if (!to_record(::getch(), record))
+        return nullptr;
+    return process(record);
+}
+
+auto get_pending() -> std::vector<std::unique_ptr<Event>>
+{
+    if (auto* headless = System::terminal.headless())
+        return get_pending_headless(*headless);
+    auto events  = std::vector<std::unique_ptr<Event>>{};
+    auto batched = false;
+    auto append  = [&events, &batched](Input_record& record) {
+        record.batched = batched;
+        batched        = true;
+        auto event     = process(record);
+        if (event != nullptr)
+            events.push_back(std::move(event));
+    };
+    // Motion reports are coalesced, only the latest one in a run is resolved
+    // to a receiver and turned into an Event.
+    auto motion     = Input_record{};
+    auto has_motion = false;
+    for (auto count = std::size_t{0}; count < max_pending_input; ++count) {
+        const auto input = ::getch();
+        if (input == ERR)
+            break;
+        if (count == 0)
+            ::timeout(0);
+        auto record = Input_record{};
+        if (input == KEY_MOUSE) {
+            auto mouse_event = ::MEVENT{};
+            if (::getmouse(&mouse_event) != OK)
+                continue;
+            if (is_motion(mouse_event)) {
+                motion     = to_record(mouse_event);
+                has_motion = true;
+                continue;
+            }
+            if (count != 0) {
+                ::ungetmouse(&mouse_event);
+                break;
+            }
+            record = to_record(mouse_event);
+            append(record);
+            break;
+        }
+        if (is_text(input)) {
+            if (has_motion) {
+                append(motion);
+                has_motion = false;
+            }
+            if (to_record(input, record))
+                append(record);
+            continue;
+        }
+        if (count != 0) {
+            ::ungetch(input);
+            break;
+        }
+        if (to_record(input, record))
+            append(record);
+        break;
+    }
+    if (has_motion)
+        append(motion);
+    ::timeout(System::terminal.refresh_rate().count());
+    return events;
+}
+
+auto make_event(const Input_record& record) -> std::unique_ptr<Event>
+{
+    switch (record.kind) {
+        case Input_record::Kind::Key: return make_keyboard_event(record.key);
+        case Input_record::Kind::Mouse: return make_mouse_event(record);
+        case Input_record::Kind::Resize: return make_resize_event(record.area);
+        case Input_record::Kind::Paste: return make_paste_event(record.text);
+    }
+    return nullptr;
+}
+
+auto initialize() -> void
+{
+    ::define_key("\033[200~", paste_begin);
+    ::define_key("\033[201~", paste_end);
+    set_private_mode(2004, true);
+    // Any-event tracking, ncurses only asks for motion while a button is held.
+    set_private_mode(1003, true);
+}
+
+auto uninitialize() -> void
+{
+    set_private_mode(1003, false);
+    set_private_mode(2004, false);
 }
 
 }  // namespace input
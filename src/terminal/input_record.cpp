@@ -0,0 +1,181 @@
+#include <cppurses/terminal/input_record.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <string>
+
+#include <cppurses/system/event.hpp>
+#include <cppurses/system/events/mouse.hpp>
+
+namespace {
+using namespace cppurses;
+
+const char magic[] = {'C', 'P', 'R', 'C'};
+constexpr auto format_version = std::uint8_t{1};
+
+/// High bit of the kind byte, set for batched records.
+constexpr auto batched_flag = std::uint8_t{0x80};
+
+/// Largest paste a recording may hold, larger sizes mean a corrupt file.
+constexpr auto max_paste_size = std::size_t{16} * 1024 * 1024;
+
+/// Pasted text is read in pieces of this many bytes.
+constexpr auto paste_chunk_size = std::size_t{4096};
+
+void write_varint(std::ostream& os, std::uint64_t value) {
+    while (value >= 0x80) {
+        os.put(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    os.put(static_cast<char>(value));
+}
+
+bool read_varint(std::istream& is, std::uint64_t& value) {
+    value = 0;
+    for (auto shift = 0; shift < 64; shift += 7) {
+        const auto byte = is.get();
+        if (byte == std::istream::traits_type::eof()) {
+            return false;
+        }
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Read a varint into an integral \p value, false if it does not fit.
+template <typename Integer_t>
+bool read_varint_as(std::istream& is, Integer_t& value) {
+    const auto max = std::numeric_limits<Integer_t>::max();
+    auto wide = std::uint64_t{0};
+    if (!read_varint(is, wide) || wide > static_cast<std::uint64_t>(max)) {
+        return false;
+    }
+    value = static_cast<Integer_t>(wide);
+    return true;
+}
+
+bool read_byte(std::istream& is, std::uint8_t& value) {
+    const auto byte = is.get();
+    if (byte == std::istream::traits_type::eof()) {
+        return false;
+    }
+    value = static_cast<std::uint8_t>(byte);
+    return true;
+}
+
+/// Read \p size bytes into \p text, false if the stream ends first.
+/** \p size comes from the file, so \p text only grows as bytes arrive. */
+bool read_text(std::istream& is, std::size_t size, std::string& text) {
+    text.clear();
+    if (size > max_paste_size) {
+        return false;
+    }
+    while (text.size() < size) {
+        const auto offset = text.size();
+        const auto count = std::min(paste_chunk_size, size - offset);
+        text.resize(offset + count);
+        if (!is.read(&text[offset], count)) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+namespace cppurses {
+
+void write_record_header(std::ostream& os) {
+    os.write(magic, sizeof(magic));
+    os.put(static_cast<char>(format_version));
+}
+
+bool read_record_header(std::istream& is) {
+    char header[sizeof(magic) + 1] = {};
+    if (!is.read(header, sizeof(header))) {
+        return false;
+    }
+    return std::equal(std::begin(magic), std::end(magic), header) &&
+           static_cast<std::uint8_t>(header[sizeof(magic)]) == format_version;
+}
+
+void write_record(std::ostream& os, const Input_record& record) {
+    auto kind = static_cast<std::uint8_t>(record.kind);
+    if (record.batched) {
+        kind |= batched_flag;
+    }
+    os.put(static_cast<char>(kind));
+    write_varint(os, record.delay);
+    switch (record.kind) {
+        case Input_record::Kind::Key:
+            write_varint(os, static_cast<std::uint64_t>(record.key));
+            break;
+        case Input_record::Kind::Mouse:
+            os.put(static_cast<char>(record.mouse_type));
+            os.put(static_cast<char>(record.button));
+            write_varint(os, record.position.x);
+            write_varint(os, record.position.y);
+            write_varint(os, static_cast<std::uint16_t>(record.device_id));
+            break;
+        case Input_record::Kind::Resize:
+            write_varint(os, record.area.width);
+            write_varint(os, record.area.height);
+            break;
+        case Input_record::Kind::Paste:
+            write_varint(os, record.text.size());
+            os.write(record.text.data(), record.text.size());
+            break;
+    }
+}
+
+bool read_record(std::istream& is, Input_record& record) {
+    auto kind = std::uint8_t{0};
+    if (!read_byte(is, kind)) {
+        return false;
+    }
+    record = Input_record{};
+    record.batched = (kind & batched_flag) != 0;
+    kind &= ~batched_flag;
+    if (kind > static_cast<std::uint8_t>(Input_record::Kind::Paste) ||
+        !read_varint(is, record.delay)) {
+        return false;
+    }
+    record.kind = static_cast<Input_record::Kind>(kind);
+    switch (record.kind) {
+        case Input_record::Kind::Key:
+            return read_varint_as(is, record.key);
+        case Input_record::Kind::Mouse: {
+            auto type = std::uint8_t{0};
+            auto button = std::uint8_t{0};
+            auto device = std::uint16_t{0};
+            if (!read_byte(is, type) || !read_byte(is, button) ||
+                !read_varint_as(is, record.position.x) ||
+                !read_varint_as(is, record.position.y) ||
+                !read_varint_as(is, device)) {
+                return false;
+            }
+            record.mouse_type = static_cast<Event::Type>(type);
+            record.button = static_cast<Mouse::Button>(button);
+            record.device_id = static_cast<short>(device);
+            return true;
+        }
+        case Input_record::Kind::Resize:
+            return read_varint_as(is, record.area.width) &&
+                   read_varint_as(is, record.area.height);
+        case Input_record::Kind::Paste: {
+            auto size = std::size_t{0};
+            return read_varint_as(is, size) &&
+                   read_text(is, size, record.text);
+        }
+    }
+    return false;
+}
+
+}  // namespace cppurses
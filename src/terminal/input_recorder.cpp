@@ -0,0 +1,49 @@
+#include <cppurses/terminal/input_recorder.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <cppurses/terminal/input_record.hpp>
+
+namespace cppurses {
+
+std::ofstream Input_recorder::file_;
+
+Input_recorder::Clock_t::time_point Input_recorder::last_batch_;
+
+void Input_recorder::start(const std::string& filename)
+{
+    Input_recorder::stop();
+    file_.open(filename, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open())
+        throw std::runtime_error{"Unable to open input recording file."};
+    write_record_header(file_);
+    last_batch_ = Clock_t::now();
+}
+
+void Input_recorder::stop()
+{
+    if (file_.is_open())
+        file_.close();
+}
+
+void Input_recorder::record(Input_record record)
+{
+    if (!file_.is_open())
+        return;
+    if (!record.batched) {
+        const auto now = Clock_t::now();
+        record.delay   = std::chrono::duration_cast<std::chrono::microseconds>(
+                           now - last_batch_)
+                           .count();
+        last_batch_ = now;
+    }
+    else
+        record.delay = 0;
+    write_record(file_, record);
+}
+
+}  // namespace cppurses
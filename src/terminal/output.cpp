@@ -17,6 +17,7 @@
 #include <cppurses/painter/color.hpp>
 #include <cppurses/painter/glyph.hpp>
 #include <cppurses/system/system.hpp>
+#include <cppurses/terminal/headless_screen.hpp>
 
 #ifndef add_wchstr
 #include <cppurses/painter/detail/extended_char.hpp>
@@ -134,14 +135,26 @@ namespace cppurses {
 namespace output {
 
 void move_cursor(std::size_t x, std::size_t y) {
+    if (auto* headless = System::terminal.headless()) {
+        headless->move_cursor(x, y);
+        return;
+    }
     ::wmove(::stdscr, static_cast<int>(y), static_cast<int>(x));
 }
 
 void refresh() {
+    if (auto* headless = System::terminal.headless()) {
+        headless->refresh();
+        return;
+    }
     ::wrefresh(::stdscr);
 }
 
 void put(const Glyph& g) {
+    if (auto* headless = System::terminal.headless()) {
+        headless->put(g);
+        return;
+    }
 #ifdef SLOW_PAINT
     paint_indicator('X');
 #endif
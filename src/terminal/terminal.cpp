@@ -18,6 +18,7 @@
 #include <cppurses/painter/palette.hpp>
 #include <cppurses/painter/rgb.hpp>
 #include <cppurses/system/system.hpp>
+#include <cppurses/terminal/headless_screen.hpp>
 #include <cppurses/terminal/input.hpp>
 
 extern "C" void handle_sigint(int /* sig*/)
@@ -44,10 +45,22 @@ Underlying_color_t scale(Underlying_color_t value)
 
 namespace cppurses {
 
+void Terminal::use_headless(Headless_screen* screen)
+{
+    if (is_initialized_)
+        throw std::logic_error{"Terminal backend set after initialize()."};
+    headless_ = screen;
+}
+
 void Terminal::initialize()
 {
     if (is_initialized_)
         return;
+    if (headless_ != nullptr) {
+        is_initialized_ = true;
+        headless_->show_cursor(show_cursor_);
+        return;
+    }
     std::setlocale(LC_ALL, "en_US.UTF-8");
 
     if (::newterm(std::getenv("TERM"), stdout, stdin) == nullptr &&
@@ -60,8 +73,9 @@ void Terminal::initialize()
     ::noecho();
     ::keypad(::stdscr, true);
     ::ESCDELAY = 1;
-    ::mousemask(ALL_MOUSE_EVENTS, nullptr);
+    ::mousemask(ALL_MOUSE_EVENTS | REPORT_MOUSE_POSITION, nullptr);
     ::mouseinterval(0);
+    input::initialize();
     this->set_refresh_rate(refresh_rate_);
     if (this->has_color()) {
         ::start_color();
@@ -76,26 +90,35 @@ void Terminal::uninitialize()
 {
     if (!is_initialized_)
         return;
+    if (headless_ != nullptr) {
+        is_initialized_ = false;
+        return;
+    }
     ::wrefresh(::stdscr);
     is_initialized_ = false;
     ::endwin();
+    input::uninitialize();
 }
 
 // getmaxx/getmaxy are non-standard.
 std::size_t Terminal::width() const
 {
+    if (headless_ != nullptr)
+        return headless_->width();
     int y{0};
     int x{0};
-    if (is_initialized_)
+    if (this->uses_curses())
         getmaxyx(::stdscr, y, x);
     return x;
 }
 
 std::size_t Terminal::height() const
 {
+    if (headless_ != nullptr)
+        return headless_->height();
     int y{0};
     int x{0};
-    if (is_initialized_)
+    if (this->uses_curses())
         getmaxyx(::stdscr, y, x);
     return y;
 }
@@ -103,7 +126,7 @@ std::size_t Terminal::height() const
 auto Terminal::set_refresh_rate(std::chrono::milliseconds duration) -> void
 {
     refresh_rate_ = duration;
-    if (is_initialized_)
+    if (this->uses_curses())
         ::timeout(refresh_rate_.count());
 }
 
@@ -118,55 +141,57 @@ void Terminal::set_background(const Glyph& tile)
 void Terminal::set_color_palette(const Palette& colors)
 {
     palette_ = colors;
-    if (is_initialized_ && this->has_color())
+    if (this->has_color())
         this->ncurses_set_palette(palette_);
 }
 
 void Terminal::show_cursor(bool show)
 {
     show_cursor_ = show;
-    if (is_initialized_)
+    if (headless_ != nullptr)
+        headless_->show_cursor(show);
+    else if (is_initialized_)
         this->ncurses_set_cursor();
 }
 
 void Terminal::raw_mode(bool enable)
 {
     raw_mode_ = enable;
-    if (is_initialized_)
+    if (this->uses_curses())
         this->ncurses_set_raw_mode();
 }
 
 bool Terminal::has_color() const
 {
-    if (is_initialized_)
+    if (this->uses_curses())
         return ::has_colors() == TRUE;
     return false;
 }
 
 bool Terminal::has_extended_colors() const
 {
-    if (is_initialized_)
+    if (this->uses_curses())
         return COLORS >= 16;
     return false;
 }
 
 short Terminal::color_count() const
 {
-    if (is_initialized_)
+    if (this->uses_curses())
         return COLORS;
     return 0;
 }
 
 bool Terminal::can_change_colors() const
 {
-    if (is_initialized_)
+    if (this->uses_curses())
         return ::can_change_color() == TRUE;
     return false;
 }
 
 short Terminal::color_pair_count() const
 {
-    if (is_initialized_)
+    if (this->uses_curses())
         return COLOR_PAIRS;
     return 0;
 }
@@ -183,7 +208,7 @@ short Terminal::color_index(short fg, short bg) const
 
 void Terminal::use_default_colors(bool use)
 {
-    if (!is_initialized_)
+    if (!this->uses_curses())
         return;
     if (use) {
         ::assume_default_colors(-1, -1);
@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <vector>
@@ -9,16 +11,24 @@
 #include <cppurses/system/events/child_event.hpp>
 #include <cppurses/system/events/disable_event.hpp>
 #include <cppurses/system/system.hpp>
+#include <cppurses/widget/detail/widget_registry.hpp>
 #include <cppurses/widget/widget.hpp>
 
 namespace cppurses {
 
+// Starts at the initial subtree_generation_, which is above the default of
+// descendants_generation_ so the first call to descendants() builds the cache.
+std::uint64_t Children_data::generation_{1};
+
 void Children_data::append(std::unique_ptr<Widget> child) {
     if (child == nullptr) {
         return;
     }
     child->set_parent(parent_);
+    this->index_name(*child);
     children_.emplace_back(std::move(child));
+    hit_index_.invalidate();
+    this->mark_changed();
     if (parent_ != nullptr) {
         children_.back()->enable(parent_->enabled());
         System::post_event<Child_added_event>(*parent_,
@@ -31,8 +41,11 @@ void Children_data::insert(std::unique_ptr<Widget> child, std::size_t index) {
         return;
     }
     child->set_parent(parent_);
+    this->index_name(*child);
     auto new_iter =
         children_.emplace(std::begin(children_) + index, std::move(child));
+    hit_index_.invalidate();
+    this->mark_changed();
     if (parent_ != nullptr) {
         (*new_iter)->enable(parent_->enabled());
         System::post_event<Child_added_event>(*parent_, *new_iter->get());
@@ -49,6 +62,9 @@ bool Children_data::has(Widget* child) const {
 }
 
 bool Children_data::has(const std::string& name) const {
+    if (!name.empty()) {
+        return names_.count(name) != 0;
+    }
     for (const std::unique_ptr<Widget>& widg : children_) {
         if (widg->name() == name) {
             return true;
@@ -57,9 +73,13 @@ bool Children_data::has(const std::string& name) const {
     return false;
 }
 
-bool Children_data::has_descendant(Widget* descendant) const {
-    for (const std::unique_ptr<Widget>& widg : children_) {
-        if (widg.get() == descendant || widg->children.has(descendant)) {
+bool Children_data::has_descendant(const Widget* descendant) const {
+    if (descendant == nullptr) {
+        return false;
+    }
+    for (const Widget* w = descendant->parent(); w != nullptr;
+         w = w->parent()) {
+        if (w == parent_) {
             return true;
         }
     }
@@ -67,12 +87,16 @@ bool Children_data::has_descendant(Widget* descendant) const {
 }
 
 bool Children_data::has_descendant(const std::string& name) const {
-    for (const std::unique_ptr<Widget>& widg : children_) {
-        if (widg->name() == name || widg->children.has(name)) {
-            return true;
-        }
+    if (!name.empty()) {
+        bool found{false};
+        detail::Widget_registry::for_each_named(name, [&](Widget& w) {
+            found = found || this->has_descendant(&w);
+        });
+        return found;
     }
-    return false;
+    const auto& all = this->descendants();
+    return std::any_of(std::begin(all), std::end(all),
+                       [&name](const Widget* w) { return w->name() == name; });
 }
 
 std::vector<Widget*> Children_data::get_descendants() const {
@@ -90,6 +114,35 @@ std::vector<Widget*> Children_data::get_descendants() const {
     return descendants;
 }
 
+const std::vector<Widget*>& Children_data::descendants() const {
+    if (descendants_generation_ != subtree_generation_) {
+        descendants_.clear();
+        append_preorder(children_, descendants_);
+        descendants_generation_ = subtree_generation_;
+    }
+    return descendants_;
+}
+
+void Children_data::mark_changed() {
+    ++generation_;
+    subtree_generation_ = generation_;
+    if (parent_ == nullptr) {
+        return;
+    }
+    for (Widget* w = parent_->parent(); w != nullptr; w = w->parent()) {
+        w->children.subtree_generation_ = generation_;
+    }
+}
+
+void Children_data::append_preorder(
+    const std::vector<std::unique_ptr<Widget>>& children,
+    std::vector<Widget*>& out) {
+    for (const std::unique_ptr<Widget>& child : children) {
+        out.push_back(child.get());
+        append_preorder(child->children.children_, out);
+    }
+}
+
 std::unique_ptr<Widget> Children_data::remove(Widget* child) {
     auto found = std::find_if(std::begin(children_), std::end(children_),
                               [child](const std::unique_ptr<Widget>& widg) {
@@ -100,6 +153,9 @@ std::unique_ptr<Widget> Children_data::remove(Widget* child) {
     }
     std::unique_ptr<Widget> removed = std::move(*found);
     children_.erase(found);
+    this->unindex_name(*removed, removed->name());
+    hit_index_.invalidate();
+    this->mark_changed();
     removed->disable();
     if (removed->parent() != nullptr) {
         System::post_event<Child_removed_event>(*removed->parent(),
@@ -113,4 +169,20 @@ std::unique_ptr<Widget> Children_data::remove(const std::string& name) {
     return this->remove(parent_->find_child(name));
 }
 
+void Children_data::index_name(Widget& child) {
+    if (!child.name().empty()) {
+        names_.emplace(child.name(), &child);
+    }
+}
+
+void Children_data::unindex_name(const Widget& child, const std::string& name) {
+    auto range = names_.equal_range(name);
+    for (auto at = range.first; at != range.second; ++at) {
+        if (at->second == &child) {
+            names_.erase(at);
+            return;
+        }
+    }
+}
+
 }  // namespace cppurses
@@ -0,0 +1,204 @@
+#include <cppurses/widget/widgets/file_viewer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <utility>
+
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/painter/utility/utf8.hpp>
+#include <cppurses/system/events/key.hpp>
+#include <cppurses/system/events/mouse.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/focus_policy.hpp>
+#include <cppurses/widget/widgets/detail/line_index.hpp>
+#include <cppurses/widget/widgets/detail/mapped_file.hpp>
+
+namespace {
+
+/// Return true if \p byte continues a multi-byte UTF-8 sequence.
+bool is_continuation(char byte) {
+    return (static_cast<unsigned char>(byte) & 0xC0) == 0x80;
+}
+
+/// Move \p offset back to the start of the UTF-8 sequence it is within.
+/** Backs up at most three bytes, invalid text can't make it go further. */
+std::size_t character_start(const char* data, std::size_t offset) {
+    for (auto back = 0;
+         back != 3 && offset != 0 && is_continuation(data[offset]); ++back) {
+        --offset;
+    }
+    return offset;
+}
+
+}  // namespace
+
+namespace cppurses {
+
+File_viewer::File_viewer() {
+    this->focus_policy = Focus_policy::Strong;
+}
+
+File_viewer::File_viewer(const std::string& filename) : File_viewer{} {
+    this->open(filename);
+}
+
+void File_viewer::open(const std::string& filename) {
+    this->close();
+    file_ = detail::Mapped_file{filename};
+    index_.build(file_.data(), file_.size());
+    this->show_lines();
+}
+
+void File_viewer::close() {
+    index_.reset();
+    file_.close();
+    top_offset_ = 0;
+    top_file_line_ = 0;
+    Text_display::clear();
+}
+
+void File_viewer::scroll_up(std::size_t n) {
+    auto moved = std::size_t{0};
+    while (moved != n && top_offset_ != 0) {
+        if (file_.data()[top_offset_ - 1] == '\n') {
+            --top_file_line_;
+        }
+        top_offset_ = this->previous_line(top_offset_);
+        ++moved;
+    }
+    this->show_lines();
+    scrolled_up(moved);
+}
+
+void File_viewer::scroll_down(std::size_t n) {
+    auto moved = std::size_t{0};
+    while (moved != n) {
+        const auto next = this->next_line(top_offset_);
+        if (next == file_.size()) {
+            break;
+        }
+        top_offset_ = next;
+        if (file_.data()[next - 1] == '\n') {
+            ++top_file_line_;
+        }
+        ++moved;
+    }
+    this->show_lines();
+    scrolled_down(moved);
+}
+
+void File_viewer::go_to_line(std::size_t line) {
+    const auto start = index_.find(line);
+    top_file_line_ = start.line;
+    top_offset_ = start.offset;
+    this->show_lines();
+}
+
+bool File_viewer::resize_event(Area new_size, Area old_size) {
+    const auto result = Text_display::resize_event(new_size, old_size);
+    this->show_lines();
+    return result;
+}
+
+bool File_viewer::key_press_event(const Key::State& keyboard) {
+    switch (keyboard.key) {
+        case Key::Arrow_up:
+            this->scroll_up(1);
+            break;
+        case Key::Arrow_down:
+            this->scroll_down(1);
+            break;
+        case Key::Previous_page:
+            this->scroll_up(this->height());
+            break;
+        case Key::Next_page:
+            this->scroll_down(this->height());
+            break;
+        case Key::Home:
+            this->go_to_line(0);
+            break;
+        case Key::End:
+            this->go_to_line(static_cast<std::size_t>(-1));
+            break;
+        default:
+            break;
+    }
+    return true;
+}
+
+bool File_viewer::mouse_press_event(const Mouse::State& mouse) {
+    if (mouse.button == Mouse::Button::ScrollUp) {
+        this->scroll_up(1);
+    } else if (mouse.button == Mouse::Button::ScrollDown) {
+        this->scroll_down(1);
+    }
+    return Text_display::mouse_press_event(mouse);
+}
+
+void File_viewer::show_lines() {
+    const char* const data = file_.data();
+    const auto limit = this->width() * this->height();
+    auto text = Glyph_string{};
+    auto line = std::wstring{};
+    auto offset = top_offset_;
+    for (auto row = std::size_t{0};
+         row != this->height() && offset != file_.size(); ++row) {
+        const auto next = this->next_line(offset);
+        // Drop the line terminator, "\n" or "\r\n".
+        auto end = next;
+        if (end != offset && data[end - 1] == '\n') {
+            --end;
+        }
+        if (end != offset && data[end - 1] == '\r') {
+            --end;
+        }
+        if (row != 0) {
+            text.append(Glyph{L'\n'});
+        }
+        line.resize(end - offset);
+        const auto decoded =
+            utility::decode_utf8(data + offset, data + end, &line[0]);
+        line.resize(std::min(decoded, limit));
+        text.append(line);
+        offset = next;
+    }
+    Text_display::set_contents(std::move(text));
+}
+
+std::size_t File_viewer::line_span() const {
+    // A character is at most four bytes.
+    return std::max(this->width() * this->height(), std::size_t{1}) * 4;
+}
+
+std::size_t File_viewer::previous_line(std::size_t offset) const {
+    // Skip the '\n' ending the previous line, then find the one before it.
+    const char* const data = file_.data();
+    auto end = offset;
+    if (data[end - 1] == '\n') {
+        --end;
+    }
+    const auto begin = end > this->line_span() ? end - this->line_span() : 0;
+    using Reverse = std::reverse_iterator<const char*>;
+    const auto found =
+        std::find(Reverse{data + end}, Reverse{data + begin}, '\n');
+    if (found != Reverse{data + begin}) {
+        return found.base() - data;
+    }
+    return begin == 0 ? 0 : character_start(data, begin);
+}
+
+std::size_t File_viewer::next_line(std::size_t offset) const {
+    const auto remaining = std::min(file_.size() - offset, this->line_span());
+    const void* newline = std::memchr(file_.data() + offset, '\n', remaining);
+    if (newline != nullptr) {
+        return static_cast<const char*>(newline) - file_.data() + 1;
+    }
+    const auto end = offset + remaining;
+    return end == file_.size() ? end : character_start(file_.data(), end);
+}
+
+}  // namespace cppurses
@@ -0,0 +1,218 @@
+#include <cppurses/widget/layouts/grid.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/detail/share_space.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/size_policy.hpp>
+#include <cppurses/widget/widget.hpp>
+
+namespace {
+using namespace cppurses;
+
+/// Return true if the hint of a policy of \p type is also its minimum.
+bool hint_is_min(Size_policy::Type type) {
+    return type == Size_policy::Fixed || type == Size_policy::Minimum ||
+           type == Size_policy::MinimumExpanding;
+}
+
+/// Return true if the hint of a policy of \p type is also its maximum.
+bool hint_is_max(Size_policy::Type type) {
+    return type == Size_policy::Fixed || type == Size_policy::Maximum;
+}
+
+/// Return the largest length \p policy accepts.
+std::size_t max_length(const Size_policy& policy) {
+    return hint_is_max(policy.type())
+               ? std::min(policy.hint(), policy.max_size())
+               : policy.max_size();
+}
+
+/// Merges the Size_policies of the cells in one track.
+/** The track is as large as its largest cell wants, Expanding if any cell
+ *  is, Fixed or Ignored only if every cell is, and Preferred otherwise. */
+class Track_merge {
+   public:
+    void add(const Size_policy& cell) {
+        const auto type = cell.type();
+        auto min = cell.min_size();
+        if (hint_is_min(type)) {
+            min = std::max(min, cell.hint());
+        }
+        hint_ = std::max(hint_, cell.hint());
+        min_ = std::max(min_, min);
+        max_ = std::max(max_, max_length(cell));
+        stretch_ = std::max(stretch_, cell.stretch());
+        expanding_ = expanding_ || type == Size_policy::Expanding ||
+                     type == Size_policy::MinimumExpanding;
+        all_fixed_ = all_fixed_ && type == Size_policy::Fixed;
+        all_ignored_ = all_ignored_ && type == Size_policy::Ignored;
+    }
+
+    void apply(Size_policy& track) const {
+        if (expanding_) {
+            track.expanding(hint_);
+        } else if (all_fixed_) {
+            track.fixed(hint_);
+        } else if (all_ignored_) {
+            track.ignored();
+        } else {
+            track.preferred(hint_);
+        }
+        track.min_size(min_);
+        track.max_size(std::max(max_, min_));
+        track.stretch(stretch_);
+    }
+
+   private:
+    std::size_t hint_{0};
+    std::size_t min_{0};
+    std::size_t max_{0};
+    std::size_t stretch_{0};
+    bool expanding_{false};
+    bool all_fixed_{true};
+    bool all_ignored_{true};
+};
+
+/// Replace \p policies with one merged from each of \p merges.
+void apply_merges(const std::vector<Track_merge>& merges,
+                  std::vector<Size_policy>& policies) {
+    policies.clear();
+    for (const Track_merge& merge : merges) {
+        policies.emplace_back(nullptr);
+        merge.apply(policies.back());
+    }
+}
+
+/// Share \p length between tracks with \p policies, into \p sizes.
+/** Starts each track at its hint, or its share of stretch if Ignored, then
+ *  grows or shrinks them as Vertical and Horizontal do. */
+void share_length(const std::vector<Size_policy>& policies,
+                  std::size_t length,
+                  std::vector<std::size_t>& sizes) {
+    sizes.assign(policies.size(), 0);
+    std::size_t total_stretch{0};
+    for (const Size_policy& policy : policies) {
+        total_stretch += policy.stretch();
+    }
+    std::size_t used{0};
+    for (std::size_t i{0}; i < policies.size(); ++i) {
+        const Size_policy& policy = policies[i];
+        if (policy.type() == Size_policy::Ignored) {
+            const double share =
+                total_stretch == 0
+                    ? 0
+                    : policy.stretch() / static_cast<double>(total_stretch);
+            sizes[i] = static_cast<std::size_t>(share * length);
+            sizes[i] = std::max(sizes[i], policy.min_size());
+            sizes[i] = std::min(sizes[i], policy.max_size());
+        } else {
+            sizes[i] = policy.hint();
+        }
+        used += sizes[i];
+    }
+    std::vector<detail::Policy_length> lengths;
+    lengths.reserve(policies.size());
+    for (std::size_t i{0}; i < policies.size(); ++i) {
+        lengths.push_back(detail::Policy_length{&policies[i], &sizes[i]});
+    }
+    if (used < length) {
+        detail::grow_lengths(lengths, length - used);
+    } else if (used > length) {
+        detail::shrink_lengths(lengths, used - length);
+    }
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace layout {
+
+Grid::Grid(std::size_t columns) : columns_{std::max(columns, std::size_t{1})} {}
+
+void Grid::set_columns(std::size_t columns) {
+    columns_ = std::max(columns, std::size_t{1});
+    policies_valid_ = false;
+    this->forget_inputs();
+    this->update_geometry();
+}
+
+std::size_t Grid::rows() const {
+    const auto count = this->children.get().size();
+    return (count + columns_ - 1) / columns_;
+}
+
+void Grid::update_geometry() {
+    if (this->inputs_unchanged()) {
+        return;
+    }
+    if (!this->children_unchanged()) {
+        policies_valid_ = false;
+    }
+    this->enable(true, false);
+    if (!policies_valid_) {
+        this->merge_policies();
+    }
+    if (!sizes_valid_ || sized_for_ != Area{this->width(), this->height()}) {
+        this->size_tracks();
+    }
+    this->place_children();
+    this->save_inputs();
+}
+
+void Grid::merge_policies() {
+    const auto& children = this->children.get();
+    std::vector<Track_merge> columns(std::min(columns_, children.size()));
+    std::vector<Track_merge> rows(this->rows());
+    for (std::size_t i{0}; i < children.size(); ++i) {
+        columns[i % columns_].add(children[i]->width_policy);
+        rows[i / columns_].add(children[i]->height_policy);
+    }
+    apply_merges(columns, column_policies_);
+    apply_merges(rows, row_policies_);
+    policies_valid_ = true;
+    sizes_valid_ = false;
+}
+
+void Grid::size_tracks() {
+    share_length(column_policies_, this->width(), column_widths_);
+    share_length(row_policies_, this->height(), row_heights_);
+    sized_for_ = Area{this->width(), this->height()};
+    sizes_valid_ = true;
+}
+
+void Grid::place_children() {
+    const auto& children = this->children.get();
+    std::size_t x{0};
+    std::size_t y{0};
+    for (std::size_t i{0}; i < children.size(); ++i) {
+        const auto column = i % columns_;
+        const auto row = i / columns_;
+        if (column == 0) {
+            x = 0;
+            if (row != 0) {
+                y += row_heights_[row - 1];
+            }
+        }
+        Widget& child = *children[i];
+        const auto width =
+            std::min(column_widths_[column], max_length(child.width_policy));
+        const auto height =
+            std::min(row_heights_[row], max_length(child.height_policy));
+        if (width == 0 || height == 0 || x + width > this->width() ||
+            y + height > this->height()) {
+            this->hide(child);
+        } else {
+            this->place(child, Point{this->inner_x() + x, this->inner_y() + y},
+                        Area{width, height});
+        }
+        x += column_widths_[column];
+    }
+}
+
+}  // namespace layout
+}  // namespace cppurses
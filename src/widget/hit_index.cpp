@@ -0,0 +1,96 @@
+#include <cppurses/widget/detail/hit_index.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include <cppurses/widget/widget.hpp>
+
+namespace {
+
+/// Parents with fewer children than this are scanned linearly.
+constexpr auto index_threshold = std::size_t{8};
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+Widget* Hit_index::find(const Widget& parent, std::size_t x, std::size_t y) {
+    const auto& children = parent.children.get();
+    if (children.size() >= index_threshold) {
+        if (stale_) {
+            this->rebuild(parent);
+        }
+        if (axis_ != Axis::None) {
+            const auto position = axis_ == Axis::Horizontal ? x : y;
+            auto after = std::upper_bound(
+                std::begin(intervals_), std::end(intervals_), position,
+                [](std::size_t p, const Interval& i) { return p < i.begin; });
+            if (after == std::begin(intervals_)) {
+                return nullptr;
+            }
+            const Interval& found = *std::prev(after);
+            if (position < found.end && contains(*found.widget, x, y)) {
+                return found.widget;
+            }
+            return nullptr;
+        }
+    }
+    for (const auto& child : children) {
+        if (contains(*child, x, y)) {
+            return child.get();
+        }
+    }
+    return nullptr;
+}
+
+bool Hit_index::contains(const Widget& w, std::size_t x, std::size_t y) {
+    if (!w.enabled()) {
+        return false;
+    }
+    const bool within_west = x >= w.inner_x();
+    const bool within_east = x < (w.inner_x() + w.width());
+    const bool within_north = y >= w.inner_y();
+    const bool within_south = y < (w.inner_y() + w.height());
+    return within_west && within_east && within_north && within_south;
+}
+
+void Hit_index::rebuild(const Widget& parent) {
+    stale_ = false;
+    if (this->build_axis(parent, Axis::Horizontal) ||
+        this->build_axis(parent, Axis::Vertical)) {
+        return;
+    }
+    intervals_.clear();
+    axis_ = Axis::None;
+}
+
+bool Hit_index::build_axis(const Widget& parent, Axis axis) {
+    axis_ = axis;
+    intervals_.clear();
+    for (const auto& child : parent.children.get()) {
+        if (!child->enabled()) {
+            continue;
+        }
+        const auto begin = axis == Axis::Horizontal ? child->x() : child->y();
+        const auto length = axis == Axis::Horizontal ? child->outer_width()
+                                                     : child->outer_height();
+        if (length != 0) {
+            intervals_.push_back(Interval{begin, begin + length, child.get()});
+        }
+    }
+    std::sort(std::begin(intervals_), std::end(intervals_),
+              [](const Interval& a, const Interval& b) {
+                  return a.begin < b.begin;
+              });
+    auto overlap = std::adjacent_find(
+        std::begin(intervals_), std::end(intervals_),
+        [](const Interval& a, const Interval& b) { return a.end > b.begin; });
+    return overlap == std::end(intervals_);
+}
+
+}  // namespace detail
+}  // namespace cppurses
@@ -1,5 +1,15 @@
 #include <cppurses/widget/layout.hpp>
 
+#include <cstddef>
+#include <memory>
+
+#include <cppurses/system/events/move_event.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/widget.hpp>
+
 namespace cppurses {
 namespace layout {
 
@@ -7,5 +17,68 @@ void Layout::update_geometry() {
     this->screen_state().optimize.child_event = true;
 }
 
+bool Layout::inputs_unchanged() const {
+    if (!inputs_saved_ || inner_position_.x != this->inner_x() ||
+        inner_position_.y != this->inner_y() ||
+        inner_size_ != Area{this->width(), this->height()}) {
+        return false;
+    }
+    return this->children_unchanged();
+}
+
+bool Layout::children_unchanged() const {
+    if (!inputs_saved_) {
+        return false;
+    }
+    const auto& children = this->children.get();
+    if (children.size() != inputs_.size()) {
+        return false;
+    }
+    for (std::size_t i{0}; i < children.size(); ++i) {
+        const Widget& child = *children[i];
+        const Child_inputs& saved = inputs_[i];
+        if (saved.widget != &child || saved.enabled != child.enabled() ||
+            saved.width_policy != child.width_policy ||
+            saved.height_policy != child.height_policy) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Layout::save_inputs() {
+    inner_position_ = Point{this->inner_x(), this->inner_y()};
+    inner_size_ = Area{this->width(), this->height()};
+    inputs_.clear();
+    for (const std::unique_ptr<Widget>& child : this->children.get()) {
+        inputs_.push_back(Child_inputs{child.get(), child->enabled(),
+                                       child->width_policy,
+                                       child->height_policy});
+    }
+    inputs_saved_ = true;
+}
+
+void Layout::forget_inputs() {
+    inputs_saved_ = false;
+}
+
+void Layout::place(Widget& child, Point position, Area size) {
+    const auto at = placed_.find(&child);
+    const bool known = at != std::end(placed_);
+    if (!known || at->second.position != position) {
+        System::post_event<Move_event>(child, position);
+    }
+    if (!known || at->second.size != size ||
+        !child.children.get().empty()) {
+        System::post_event<Resize_event>(child, size);
+    }
+    placed_[&child] = Placement{position, size};
+}
+
+void Layout::hide(Widget& child) {
+    placed_.erase(&child);
+    child.disable(true, false);  // don't send child_polished_events
+}
+
 }  // namespace layout
 }  // namespace cppurses
@@ -0,0 +1,64 @@
+#include <cppurses/widget/layout_batch.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include <cppurses/system/events/child_event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/widget.hpp>
+
+namespace {
+using namespace cppurses;
+
+/// Batches alive on this thread, innermost last.
+thread_local std::vector<Layout_batch*> active_batches;
+
+bool is_child(const Widget& parent, const Widget* child) {
+    const auto& children = parent.children.get();
+    return std::any_of(std::begin(children), std::end(children),
+                       [child](const std::unique_ptr<Widget>& c) {
+                           return c.get() == child;
+                       });
+}
+
+}  // namespace
+
+namespace cppurses {
+
+Layout_batch::Layout_batch(Widget& parent) : parent_{parent} {
+    active_batches.push_back(this);
+}
+
+Layout_batch::~Layout_batch() {
+    this->commit();
+}
+
+void Layout_batch::commit() {
+    if (committed_) {
+        return;
+    }
+    committed_ = true;
+    const auto at = std::find(std::begin(active_batches),
+                              std::end(active_batches), this);
+    if (at != std::end(active_batches)) {
+        active_batches.erase(at);
+    }
+    if (pending_child_ != nullptr && is_child(parent_, pending_child_)) {
+        Layout_batch::notify(parent_, *pending_child_);
+    }
+    pending_child_ = nullptr;
+}
+
+void Layout_batch::notify(Widget& parent, Widget& child) {
+    for (auto b = active_batches.rbegin(); b != active_batches.rend(); ++b) {
+        if (&(*b)->parent_ == &parent) {
+            (*b)->pending_child_ = &child;
+            return;
+        }
+    }
+    System::post_event<Child_polished_event>(parent, child);
+}
+
+}  // namespace cppurses
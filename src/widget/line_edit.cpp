@@ -106,6 +106,25 @@ bool Line_edit::mouse_press_event(const Mouse::State& mouse)
     return Textbox::mouse_press_event(mouse);
 }
 
+bool Line_edit::paste_event(const Glyph_string& text)
+{
+    // Line_edit is a single line; drop newlines and anything not validated.
+    auto accepted = Glyph_string{};
+    for (const Glyph& glyph : text) {
+        if (glyph.symbol == L'\n')
+            continue;
+        const auto symbol = glyph.symbol;
+        if (symbol <= 0x7F && !validator_(static_cast<char>(symbol)))
+            continue;
+        accepted.append(glyph);
+    }
+    if (!accepted.empty() && on_initial_) {
+        this->clear();
+        on_initial_ = false;
+    }
+    return Textbox::paste_event(accepted);
+}
+
 bool Line_edit::focus_in_event()
 {
     if (on_initial_)
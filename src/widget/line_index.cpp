@@ -0,0 +1,94 @@
+#include <cppurses/widget/widgets/detail/line_index.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+/// Return the offset of the line after the one starting at \p offset.
+std::size_t next_line(const char* data, std::size_t size, std::size_t offset) {
+    const void* newline = std::memchr(data + offset, '\n', size - offset);
+    if (newline == nullptr) {
+        return size;
+    }
+    return static_cast<const char*>(newline) - data + 1;
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+constexpr std::size_t Line_index::stride;
+
+void Line_index::build(const char* data, std::size_t size) {
+    this->reset();
+    data_ = data;
+    size_ = size;
+    if (size_ == 0) {
+        complete_ = true;
+        return;
+    }
+    checkpoints_.push_back(0);
+    lines_found_ = 1;
+    worker_ = std::thread{[this] { this->scan(); }};
+}
+
+void Line_index::reset() {
+    stop_ = true;
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    stop_ = false;
+    complete_ = false;
+    lines_found_ = 0;
+    checkpoints_.clear();
+    data_ = nullptr;
+    size_ = 0;
+}
+
+auto Line_index::find(std::size_t line) const -> Line_start {
+    if (size_ == 0) {
+        return {0, 0};
+    }
+    auto start = Line_start{0, 0};
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        const auto checkpoint =
+            std::min(line / stride, checkpoints_.size() - 1);
+        start = Line_start{checkpoint * stride, checkpoints_[checkpoint]};
+    }
+    while (start.line != line) {
+        const auto next = next_line(data_, size_, start.offset);
+        if (next == size_) {
+            break;
+        }
+        start.offset = next;
+        ++start.line;
+    }
+    return start;
+}
+
+void Line_index::scan() {
+    auto offset = std::size_t{0};
+    auto line = std::size_t{0};
+    while (!stop_) {
+        offset = next_line(data_, size_, offset);
+        if (offset == size_) {
+            break;
+        }
+        ++line;
+        if (line % stride == 0) {
+            std::lock_guard<std::mutex> lock{mtx_};
+            checkpoints_.push_back(offset);
+        }
+        lines_found_.store(line + 1, std::memory_order_relaxed);
+    }
+    complete_ = !stop_;
+}
+
+}  // namespace detail
+}  // namespace cppurses
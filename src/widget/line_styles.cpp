@@ -0,0 +1,59 @@
+#include <cppurses/widget/widgets/detail/line_styles.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include <cppurses/widget/widgets/highlighter.hpp>
+
+namespace cppurses {
+namespace detail {
+
+void Line_styles::set_highlighter(std::unique_ptr<Highlighter> highlighter,
+                                  std::size_t line_count) {
+    highlighter_ = std::move(highlighter);
+    this->reset(line_count);
+}
+
+void Line_styles::reset(std::size_t line_count) {
+    lines_.clear();
+    valid_ = 0;
+    if (this->active()) {
+        lines_.resize(line_count, Line{0, 0, Spans{}, true});
+    }
+}
+
+void Line_styles::replace(std::size_t first,
+                          std::size_t removed,
+                          std::size_t inserted) {
+    if (!this->active()) {
+        return;
+    }
+    // Reuse entries in place, so the common edit that keeps the line count
+    // does not shift the lines after it.
+    const auto reused = std::min(removed, inserted);
+    for (auto i = first; i != first + reused; ++i) {
+        lines_[i].changed = true;
+    }
+    const auto at = std::begin(lines_) + first + reused;
+    if (removed > reused) {
+        lines_.erase(at, at + (removed - reused));
+    } else if (inserted > reused) {
+        lines_.insert(at, inserted - reused, Line{0, 0, Spans{}, true});
+    }
+    valid_ = std::min(valid_, first);
+}
+
+void Line_styles::erase_front(std::size_t count) {
+    if (!this->active()) {
+        return;
+    }
+    lines_.erase(std::begin(lines_), std::begin(lines_) + count);
+    // The new first line starts in State 0, which is checked when restyling.
+    valid_ = 0;
+}
+
+}  // namespace detail
+}  // namespace cppurses
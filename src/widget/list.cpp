@@ -0,0 +1,239 @@
+#include <cppurses/widget/widgets/list.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <signals/slot.hpp>
+
+#include <cppurses/painter/attribute.hpp>
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/painter/glyph_string_view.hpp>
+#include <cppurses/painter/painter.hpp>
+#include <cppurses/system/events/key.hpp>
+#include <cppurses/system/events/mouse.hpp>
+#include <cppurses/widget/focus_policy.hpp>
+#include <cppurses/widget/widgets/list_source.hpp>
+
+namespace cppurses {
+
+List::List() {
+    this->focus_policy = Focus_policy::Strong;
+}
+
+List::List(const List_source& source) : List{} {
+    this->set_source(&source);
+}
+
+void List::set_source(const List_source* source) {
+    source_ = source;
+    top_ = 0;
+    selected_ = 0;
+    this->update();
+}
+
+void List::refresh() {
+    const auto count = this->row_count();
+    selected_ = std::min(selected_, count == 0 ? 0 : count - 1);
+    top_ = std::min(top_, this->max_top());
+    this->update();
+}
+
+void List::add_column(Glyph_string heading, std::size_t width) {
+    columns_.push_back(Column{std::move(heading), width});
+    this->update();
+}
+
+void List::clear_columns() {
+    columns_.clear();
+    this->update();
+}
+
+void List::select(std::size_t index) {
+    const auto count = this->row_count();
+    if (count == 0) {
+        return;
+    }
+    index = std::min(index, count - 1);
+    const auto visible = this->visible_rows();
+    if (index < top_) {
+        top_ = index;
+    } else if (visible != 0 && index >= top_ + visible) {
+        top_ = index - visible + 1;
+    }
+    this->update();
+    if (index != selected_) {
+        selected_ = index;
+        selection_changed(selected_);
+    }
+}
+
+void List::select_up(std::size_t n) {
+    this->select(selected_ - std::min(n, selected_));
+}
+
+void List::select_down(std::size_t n) {
+    const auto count = this->row_count();
+    this->select(n < count - selected_ ? selected_ + n : count);
+}
+
+void List::scroll_up(std::size_t n) {
+    top_ -= std::min(n, top_);
+    this->update();
+}
+
+void List::scroll_down(std::size_t n) {
+    top_ = std::min(top_ + n, this->max_top());
+    this->update();
+}
+
+std::size_t List::visible_rows() const {
+    const auto header = this->has_headings() ? std::size_t{1} : 0;
+    return this->height() > header ? this->height() - header : 0;
+}
+
+void List::set_selected_attribute(const Attribute& attr) {
+    selected_attr_ = attr;
+    this->update();
+}
+
+bool List::paint_event() {
+    Painter p{*this};
+    auto y = std::size_t{0};
+    if (this->has_headings()) {
+        cells_.clear();
+        for (const Column& column : columns_) {
+            cells_.push_back(column.heading);
+        }
+        this->paint_cells(p, cells_, y++, false);
+    }
+    const auto count = this->row_count();
+    for (auto index = top_; index < count && y < this->height(); ++index) {
+        cells_.clear();
+        source_->row(index, cells_);
+        this->paint_cells(p, cells_, y++, index == selected_);
+    }
+    return Widget::paint_event();
+}
+
+bool List::key_press_event(const Key::State& keyboard) {
+    switch (keyboard.key) {
+        case Key::Arrow_up:
+        case Key::k:
+            this->select_up(1);
+            break;
+        case Key::Arrow_down:
+        case Key::j:
+            this->select_down(1);
+            break;
+        case Key::Previous_page:
+            this->select_up(this->visible_rows());
+            break;
+        case Key::Next_page:
+            this->select_down(this->visible_rows());
+            break;
+        case Key::Home:
+            this->select(0);
+            break;
+        case Key::End:
+            this->select(static_cast<std::size_t>(-1));
+            break;
+        case Key::Enter:
+            if (this->row_count() != 0) {
+                selected(selected_);
+            }
+            break;
+        default:
+            break;
+    }
+    return true;
+}
+
+bool List::mouse_press_event(const Mouse::State& mouse) {
+    if (mouse.button == Mouse::Button::ScrollUp) {
+        this->scroll_up(1);
+    } else if (mouse.button == Mouse::Button::ScrollDown) {
+        this->scroll_down(1);
+    } else if (mouse.button == Mouse::Button::Left) {
+        const auto header = this->has_headings() ? std::size_t{1} : 0;
+        const auto index = top_ + mouse.local.y - header;
+        if (mouse.local.y >= header && index < this->row_count()) {
+            this->select(index);
+            selected(selected_);
+        }
+    }
+    return Widget::mouse_press_event(mouse);
+}
+
+std::size_t List::row_count() const {
+    return source_ == nullptr ? 0 : source_->size();
+}
+
+bool List::has_headings() const {
+    return std::any_of(
+        std::begin(columns_), std::end(columns_),
+        [](const Column& column) { return !column.heading.empty(); });
+}
+
+std::size_t List::max_top() const {
+    const auto count = this->row_count();
+    const auto visible = this->visible_rows();
+    return count > visible ? count - visible : 0;
+}
+
+void List::paint_cells(Painter& p,
+                       const std::vector<Glyph_string>& cells,
+                       std::size_t y,
+                       bool highlight) {
+    if (highlight) {
+        p.fill(Glyph{L' ', selected_attr_}, 0, y, this->width(), 1);
+    }
+    const auto column_count = std::max(columns_.size(), std::size_t{1});
+    auto x = std::size_t{0};
+    for (std::size_t i{0}; i < column_count && x < this->width(); ++i) {
+        const bool last = i + 1 == column_count;
+        auto width = this->width() - x;
+        if (!last) {
+            width = std::min(width, columns_[i].width);
+        }
+        if (i < cells.size()) {
+            auto text = Glyph_string_view{cells[i]}.substr(
+                0, last || width == 0 ? width : width - 1);
+            if (highlight) {
+                auto styled = text.glyph_string();
+                styled.add_attributes(selected_attr_);
+                p.put(styled, x, y);
+            } else {
+                p.put(text, x, y);
+            }
+        }
+        x += width;
+    }
+}
+
+namespace slot {
+
+sig::Slot<void(std::size_t)> select(List& list) {
+    sig::Slot<void(std::size_t)> slot{
+        [&list](auto index) { list.select(index); }};
+    slot.track(list.destroyed);
+    return slot;
+}
+
+sig::Slot<void()> select(List& list, std::size_t index) {
+    sig::Slot<void()> slot{[&list, index] { list.select(index); }};
+    slot.track(list.destroyed);
+    return slot;
+}
+
+sig::Slot<void()> refresh(List& list) {
+    sig::Slot<void()> slot{[&list] { list.refresh(); }};
+    slot.track(list.destroyed);
+    return slot;
+}
+
+}  // namespace slot
+}  // namespace cppurses
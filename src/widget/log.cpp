@@ -1,28 +1,146 @@
 #include <cppurses/widget/widgets/log.hpp>
 
+#include <chrono>
 #include <cstddef>
+#include <iterator>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <signals/slot.hpp>
 
+#include <cppurses/painter/glyph.hpp>
 #include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/system/event.hpp>
 #include <cppurses/system/events/key.hpp>
+#include <cppurses/system/system.hpp>
+
+namespace {
+using namespace cppurses;
+
+/// Posted once per batch of post_message_async() calls.
+class Flush_messages_event : public Event {
+   public:
+    explicit Flush_messages_event(Log& receiver)
+        : Event{Event::Custom, receiver}, log_{receiver} {}
+
+    bool send() const override {
+        log_.flush_async_messages();
+        return true;
+    }
+
+    bool filter_send(Widget& /* filter */) const override { return false; }
+
+   private:
+    Log& log_;
+};
+
+}  // namespace
 
 namespace cppurses {
 
 void Log::post_message(Glyph_string message) {
-    if (!this->contents().empty()) {
-        this->append('\n');
+    auto messages = std::vector<Glyph_string>{};
+    messages.push_back(std::move(message));
+    this->post_messages(messages);
+}
+
+void Log::post_message_async(Glyph_string message, std::string source) {
+    // Only the push that finds the queue empty posts, once per batch.
+    if (pending_.push(Pending_message{std::move(message), std::move(source)})) {
+        System::post_event<Flush_messages_event>(*this);
+    }
+}
+
+void Log::flush_async_messages() {
+    auto pending = pending_.pop_all();
+    if (pending.empty()) {
+        return;
+    }
+    const auto now = Clock_t::now();
+    auto messages = std::vector<Glyph_string>{};
+    messages.reserve(pending.size());
+    for (auto& p : pending) {
+        this->record(p, now);
+        messages.push_back(std::move(p.message));
+    }
+    this->post_messages(messages);
+}
+
+void Log::record(const Pending_message& pending, Clock_t::time_point now) {
+    auto& stats = source_stats_[pending.source];
+    ++stats.messages;
+    stats.glyphs += pending.message.size();
+    auto window = rate_windows_.find(pending.source);
+    if (window == std::end(rate_windows_)) {
+        rate_windows_.emplace(pending.source, Rate_window{now, 1});
+        return;
+    }
+    ++window->second.messages;
+    const auto seconds =
+        std::chrono::duration<double>{now - window->second.start}.count();
+    if (seconds >= 1.0) {
+        stats.rate = window->second.messages / seconds;
+        window->second = Rate_window{now, 0};
     }
-    this->append(std::move(message));
-    this->update_display();
+}
+
+void Log::post_messages(std::vector<Glyph_string>& messages) {
+    // Contents can be emptied through Text_display::clear().
+    if (this->contents_size() == 0) {
+        message_lengths_.clear();
+    }
+    // Messages that would be evicted right away are never appended.
+    auto first = std::begin(messages);
+    if (messages.size() > max_messages_) {
+        const auto kept = max_messages_ == 0 ? 1 : max_messages_;
+        first = std::end(messages) - kept;
+    }
+    auto text = Glyph_string{};
+    for (auto it = first; it != std::end(messages); ++it) {
+        if (!message_lengths_.empty()) {
+            text.append(Glyph{L'\n'});
+        }
+        message_lengths_.push_back(it->size());
+        text.append(*it);
+    }
+    this->append(std::move(text));
+    this->enforce_limits();
     std::size_t tl = this->top_line();
     std::size_t h = this->height();
     std::size_t nol = this->line_count();
     if (tl + h < nol) {
         this->scroll_down(nol - tl - h);
     }
-    this->set_cursor(this->contents().size());
+    this->set_cursor(this->contents_size());
+}
+
+void Log::set_max_messages(std::size_t count) {
+    max_messages_ = count;
+    this->enforce_limits();
+}
+
+void Log::set_max_bytes(std::size_t bytes) {
+    max_bytes_ = bytes;
+    this->enforce_limits();
+}
+
+void Log::enforce_limits() {
+    const auto over_limit = [this] {
+        return message_lengths_.size() > max_messages_ ||
+               this->contents_size() > max_bytes_ / sizeof(Glyph);
+    };
+    while (message_lengths_.size() > 1 && over_limit()) {
+        // The message and the '\n' separating it from the next message.
+        this->erase_front(message_lengths_.front() + 1);
+        message_lengths_.pop_front();
+    }
+}
+
+bool Log::enable_event() {
+    // A flush event is dropped while disabled, the batch would be stuck.
+    this->flush_async_messages();
+    return Textbox::enable_event();
 }
 
 bool Log::key_press_event(const Key::State& keyboard) {
@@ -33,6 +151,10 @@ bool Log::key_press_event(const Key::State& keyboard) {
     return true;
 }
 
+bool Log::paste_event(const Glyph_string& /* text */) {
+    return true;
+}
+
 namespace slot {
 
 sig::Slot<void(Glyph_string)> post_message(Log& log) {
@@ -0,0 +1,76 @@
+#include <cppurses/widget/widgets/detail/mapped_file.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+[[noreturn]] void throw_error(const std::string& what,
+                              const std::string& filename) {
+    throw std::runtime_error{"Mapped_file: " + what + " '" + filename +
+                             "': " + std::strerror(errno)};
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+Mapped_file::Mapped_file(const std::string& filename) {
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd == -1) {
+        throw_error("cannot open", filename);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) == -1) {
+        ::close(fd);
+        throw_error("cannot stat", filename);
+    }
+    size_ = static_cast<std::size_t>(info.st_size);
+    // mmap does not accept a length of zero, an empty file maps to nothing.
+    if (size_ != 0) {
+        void* address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) {
+            ::close(fd);
+            throw_error("cannot map", filename);
+        }
+        data_ = static_cast<const char*>(address);
+    }
+    // The mapping keeps its own reference to the file.
+    ::close(fd);
+}
+
+Mapped_file::Mapped_file(Mapped_file&& other)
+    : data_{other.data_}, size_{other.size_} {
+    other.data_ = nullptr;
+    other.size_ = 0;
+}
+
+Mapped_file& Mapped_file::operator=(Mapped_file&& other) {
+    if (this != &other) {
+        this->close();
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+    }
+    return *this;
+}
+
+void Mapped_file::close() {
+    if (data_ != nullptr) {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+}
+
+}  // namespace detail
+}  // namespace cppurses
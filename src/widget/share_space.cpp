@@ -0,0 +1,166 @@
+#include <cppurses/widget/detail/share_space.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <cppurses/widget/size_policy.hpp>
+
+namespace {
+using namespace cppurses;
+
+bool grows_first(Size_policy::Type type) {
+    return type == Size_policy::Expanding ||
+           type == Size_policy::MinimumExpanding;
+}
+
+bool grows_second(Size_policy::Type type) {
+    return type == Size_policy::Preferred || type == Size_policy::Minimum ||
+           type == Size_policy::Ignored;
+}
+
+bool shrinks_first(Size_policy::Type type) {
+    return type == Size_policy::Maximum || type == Size_policy::Preferred ||
+           type == Size_policy::Ignored;
+}
+
+bool shrinks_second(Size_policy::Type type) {
+    return type == Size_policy::Expanding;
+}
+
+/// Share \p space among the \p lengths in \p group, return what is left.
+/** \p grow adds each amount to its length, otherwise it is subtracted. */
+std::size_t share_in_group(
+    const std::vector<detail::Policy_length>& lengths,
+    bool (*group)(Size_policy::Type),
+    bool grow,
+    std::size_t space) {
+    std::vector<detail::Share> shares;
+    std::vector<std::size_t*> members;
+    for (const detail::Policy_length& l : lengths) {
+        const Size_policy& policy = *l.policy;
+        if (!group(policy.type())) {
+            continue;
+        }
+        const auto stretch = static_cast<double>(policy.stretch());
+        const auto length = *l.length;
+        if (grow) {
+            const auto max = policy.max_size();
+            shares.push_back(
+                detail::Share{stretch, max > length ? max - length : 0, 0});
+        } else {
+            const auto min = policy.min_size();
+            const auto weight = 1.0 / std::max(stretch, 1.0);
+            shares.push_back(
+                detail::Share{weight, length > min ? length - min : 0, 0});
+        }
+        members.push_back(l.length);
+    }
+    space = detail::share_space(shares, space);
+    for (std::size_t i{0}; i < shares.size(); ++i) {
+        if (grow) {
+            *members[i] += shares[i].amount;
+        } else {
+            *members[i] -= shares[i].amount;
+        }
+    }
+    return space;
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+std::size_t share_space(std::vector<Share>& shares, std::size_t space) {
+    bool weighted{false};
+    for (Share& share : shares) {
+        share.amount = 0;
+        weighted = weighted || (share.weight > 0 && share.capacity > 0);
+    }
+    // Index and weight of each Share that can take space.
+    std::vector<std::size_t> open;
+    std::vector<double> weights(shares.size(), 1.0);
+    double total_weight{0};
+    for (std::size_t i{0}; i < shares.size(); ++i) {
+        if (weighted) {
+            weights[i] = shares[i].weight;
+        }
+        if (shares[i].capacity > 0 && weights[i] > 0) {
+            open.push_back(i);
+            total_weight += weights[i];
+        }
+    }
+    // Shares that fill first come first, capacity / weight ascending.
+    std::stable_sort(std::begin(open), std::end(open),
+                     [&](std::size_t a, std::size_t b) {
+                         return shares[a].capacity * weights[b] <
+                                shares[b].capacity * weights[a];
+                     });
+    auto first_open = std::begin(open);
+    for (; first_open != std::end(open); ++first_open) {
+        Share& share = shares[*first_open];
+        const double fair = space * (weights[*first_open] / total_weight);
+        if (share.capacity > fair) {
+            break;
+        }
+        share.amount = share.capacity;
+        space -= share.capacity;
+        total_weight -= weights[*first_open];
+    }
+    if (first_open == std::end(open)) {
+        return space;
+    }
+
+    // No remaining Share fills, hand out the floor of each exact portion.
+    std::sort(first_open, std::end(open));
+    std::vector<std::pair<double, std::size_t>> fractions;
+    std::size_t given{0};
+    for (auto i = first_open; i != std::end(open); ++i) {
+        const double exact = space * (weights[*i] / total_weight);
+        const auto whole = std::min(static_cast<std::size_t>(exact),
+                                    shares[*i].capacity);
+        shares[*i].amount = whole;
+        given += whole;
+        fractions.emplace_back(exact - std::floor(exact), *i);
+    }
+    std::stable_sort(std::begin(fractions), std::end(fractions),
+                     [](const std::pair<double, std::size_t>& a,
+                        const std::pair<double, std::size_t>& b) {
+                         return a.first > b.first;
+                     });
+    // Rounding leaves less than one unit per Share, largest fractions first.
+    auto leftover = space - given;
+    while (leftover > 0) {
+        const auto before = leftover;
+        for (const auto& fraction : fractions) {
+            Share& share = shares[fraction.second];
+            if (leftover > 0 && share.amount < share.capacity) {
+                ++share.amount;
+                --leftover;
+            }
+        }
+        if (leftover == before) {
+            break;
+        }
+    }
+    return leftover;
+}
+
+std::size_t grow_lengths(const std::vector<Policy_length>& lengths,
+                         std::size_t space) {
+    space = share_in_group(lengths, grows_first, true, space);
+    return share_in_group(lengths, grows_second, true, space);
+}
+
+std::size_t shrink_lengths(const std::vector<Policy_length>& lengths,
+                           std::size_t excess) {
+    excess = share_in_group(lengths, shrinks_first, false, excess);
+    return share_in_group(lengths, shrinks_second, false, excess);
+}
+
+}  // namespace detail
+}  // namespace cppurses
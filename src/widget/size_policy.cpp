@@ -2,15 +2,14 @@
 
 #include <cstddef>
 
-#include <cppurses/system/events/child_event.hpp>
-#include <cppurses/system/system.hpp>
+#include <cppurses/widget/layout_batch.hpp>
 #include <cppurses/widget/widget.hpp>
 
 namespace cppurses {
 
 void Size_policy::notify_parent() const {
-    if (owner_->parent() != nullptr) {
-        System::post_event<Child_polished_event>(*(owner_->parent()), *owner_);
+    if (owner_ != nullptr && owner_->parent() != nullptr) {
+        Layout_batch::notify(*(owner_->parent()), *owner_);
     }
 }
 
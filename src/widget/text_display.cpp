@@ -3,32 +3,93 @@
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <signals/signal.hpp>
 
 #include <cppurses/painter/attribute.hpp>
+#include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/glyph.hpp>
 #include <cppurses/painter/glyph_string.hpp>
 #include <cppurses/painter/painter.hpp>
 #include <cppurses/widget/point.hpp>
 
+namespace {
+
+/// Break \p text into lines of at most \p width Glyphs, starting at \p begin.
+/** \p begin must be the start of a line. Calls \p emit with the start index
+ *  and length of each line in order, stopping early if it returns false. The
+ *  last line is always emitted, and can be empty. Each line only depends on
+ *  the Glyphs from its start up to \p width Glyphs past it. */
+template <typename Emit_t>
+void wrap_lines(const cppurses::Glyph_rope& text,
+                std::size_t width,
+                bool word_wrap,
+                std::size_t begin,
+                Emit_t&& emit) {
+    std::size_t start_index{begin};
+    std::size_t length{0};
+    std::size_t last_space{0};
+    auto glyph = std::begin(text) + begin;
+    for (std::size_t i{begin}; i < text.size(); ++i, ++glyph) {
+        const auto symbol = glyph->symbol;
+        ++length;
+        if (word_wrap && symbol == L' ') {
+            last_space = length;
+        }
+        if (symbol == L'\n') {
+            if (!emit(start_index, length - 1)) {
+                return;
+            }
+            start_index += length;
+            length = 0;
+            last_space = 0;
+        } else if (length == width) {
+            if (word_wrap && last_space > 0) {
+                i -= length - last_space;
+                glyph -= length - last_space;
+                length = last_space;
+                last_space = 0;
+            }
+            if (!emit(start_index, length)) {
+                return;
+            }
+            start_index += length;
+            length = 0;
+        }
+    }
+    emit(start_index, length);
+}
+
+}  // namespace
+
 namespace cppurses {
 
-Text_display::Text_display(Glyph_string contents)
-    : contents_{std::move(contents)} {
+Text_display::Text_display(Glyph_string contents) : contents_{contents} {
     this->set_name("Text_display");
 }
 
 // This call to update_display is required here, and not in paint_event.
 // Could probably be refactored so this can be in paint_event, more efficient.
 void Text_display::update() {
-    this->update_display();
+    if (display_dirty_ || this->width() != wrapped_width_) {
+        this->update_display();
+    }
     Widget::update();
 }
 
 void Text_display::set_contents(Glyph_string text) {
+    this->set_contents(Glyph_rope{text});
+}
+
+void Text_display::set_contents(Glyph_rope text) {
     contents_ = std::move(text);
+    display_dirty_ = true;
+    search_.refresh(contents_);
+    selected_match_ = Glyph_string::npos;
     this->update();
     top_line_ = 0;
     this->cursor.set_position({0, 0});
@@ -50,8 +111,9 @@ void Text_display::insert(Glyph_string text, std::size_t index) {
             }
         }
     }
-    contents_.insert(std::begin(contents_) + index, std::begin(text),
-                     std::end(text));
+    contents_.insert(index, text);
+    this->reflow(index, 0, text.size());
+    search_.edit(contents_, index, 0, text.size());
     this->update();
     contents_modified(contents_);
 }
@@ -64,7 +126,10 @@ void Text_display::append(Glyph_string text) {
             }
         }
     }
+    const auto index = contents_.size();
     contents_.append(text);
+    this->reflow(index, 0, text.size());
+    search_.edit(contents_, index, 0, text.size());
     this->update();
     contents_modified(contents_);
 }
@@ -73,11 +138,10 @@ void Text_display::erase(std::size_t index, std::size_t length) {
     if (contents_.empty() || index >= contents_.size()) {
         return;
     }
-    auto end = std::begin(contents_) + length + index;
-    if (length == Glyph_string::npos) {
-        end = std::end(contents_);
-    }
-    contents_.erase(std::begin(contents_) + index, end);
+    const auto removed = std::min(length, contents_.size() - index);
+    contents_.erase(index, removed);
+    this->reflow(index, removed, 0);
+    search_.edit(contents_, index, removed, 0);
     this->update();
     contents_modified(contents_);
 }
@@ -87,12 +151,17 @@ void Text_display::pop_back() {
         return;
     }
     contents_.pop_back();
+    this->reflow(contents_.size(), 1, 0);
+    search_.edit(contents_, contents_.size(), 1, 0);
     this->update();
     contents_modified(contents_);
 }
 
 void Text_display::clear() {
     contents_.clear();
+    display_dirty_ = true;
+    search_.refresh(contents_);
+    selected_match_ = Glyph_string::npos;
     this->cursor.set_x(0);
     this->cursor.set_y(0);
     this->update();
@@ -126,16 +195,19 @@ void Text_display::scroll_down(std::size_t n) {
 
 void Text_display::enable_word_wrap(bool enable) {
     word_wrap_enabled_ = enable;
+    display_dirty_ = true;
     this->update();
 }
 
 void Text_display::disable_word_wrap(bool disable) {
     word_wrap_enabled_ = !disable;
+    display_dirty_ = true;
     this->update();
 }
 
 void Text_display::toggle_word_wrap() {
     word_wrap_enabled_ = !word_wrap_enabled_;
+    display_dirty_ = true;
     this->update();
 }
 
@@ -147,7 +219,7 @@ std::size_t Text_display::row_length(std::size_t y) const {
 std::size_t Text_display::index_at(Point position) const {
     auto line = this->top_line() + position.y;
     if (line >= display_state_.size()) {
-        return this->contents().size();
+        return this->contents_size();
     }
     auto info = display_state_.at(line);
     if (position.x >= info.length) {
@@ -156,12 +228,12 @@ std::size_t Text_display::index_at(Point position) const {
         } else if (this->top_line() + position.y != this->last_line()) {
             return this->first_index_at(this->top_line() + position.y + 1) - 1;
         } else if (this->top_line() + position.y == this->last_line()) {
-            return this->contents().size();
+            return this->contents_size();
         } else {
             position.x = info.length - 1;
         }
     }
-    return info.start_index + position.x;
+    return this->start_of(info) + position.x;
 }
 
 Point Text_display::display_position(std::size_t index) const {
@@ -174,8 +246,8 @@ Point Text_display::display_position(std::size_t index) const {
     if (line > last_shown_line) {
         line = last_shown_line;
         index = this->last_index_at(line);
-    } else if (index > this->contents().size()) {
-        index = this->contents().size();
+    } else if (index > this->contents_size()) {
+        index = this->contents_size();
     }
     position.y = line - this->top_line();
     position.x = index - this->first_index_at(line);
@@ -186,8 +258,6 @@ bool Text_display::paint_event() {
     Painter p{*this};
     std::size_t line_n{0};
     auto paint = [&p, &line_n, this](const Line_info& line) {
-        auto sub_begin = std::begin(this->contents_) + line.start_index;
-        auto sub_end = sub_begin + line.length;
         std::size_t start{0};
         switch (alignment_) {
             case Alignment::Left:
@@ -200,7 +270,37 @@ bool Text_display::paint_event() {
                 start = this->width() - line.length;
                 break;
         }
-        p.put(Glyph_string(sub_begin, sub_end), start, line_n++);
+        const auto index = this->start_of(line);
+        const auto y = line_n++;
+        this->paint_run(p, index, line.length, start, y);
+        if (styles_.active()) {
+            const auto& spans = styles_.spans(
+                this->top_line() + y,
+                [this](std::size_t n, std::wstring& text) {
+                    this->line_text(n, text);
+                });
+            for (const auto& span : spans) {
+                if (span.offset >= line.length) {
+                    break;
+                }
+                const auto count =
+                    std::min(span.length, line.length - span.offset);
+                this->paint_run(p, index + span.offset, count,
+                                start + span.offset, y, &span.brush);
+            }
+        }
+        if (search_.active()) {
+            const auto& matches = search_.matches();
+            const auto end = index + line.length;
+            const auto length = search_.pattern_length();
+            for (auto m = search_.first_reaching(index);
+                 m != matches.size() && matches[m] < end; ++m) {
+                const auto first = std::max(index, matches[m]);
+                const auto last = std::min(end, matches[m] + length);
+                this->paint_run(p, first, last - first, start + first - index,
+                                y, &match_brush);
+            }
+        }
     };
     auto begin = std::begin(display_state_) + this->top_line();
     auto end = std::end(display_state_);
@@ -223,54 +323,234 @@ bool Text_display::paint_event() {
 //     return;
 // }
 
+void Text_display::paint_run(Painter& painter,
+                             std::size_t index,
+                             std::size_t count,
+                             std::size_t x,
+                             std::size_t y,
+                             const Brush* overlay) const {
+    const auto end = index + count;
+    if (overlay == nullptr) {
+        // A run can span chunks of the rope, each is put without a copy.
+        while (index != end) {
+            const auto run = contents_.chunk_at(index, end - index);
+            painter.put(run, x, y);
+            x += run.size();
+            index += run.size();
+        }
+        return;
+    }
+    for (; index != end; ++index) {
+        auto glyph = contents_[index];
+        auto brush = *overlay;
+        imprint(glyph.brush, brush);
+        glyph.brush = brush;
+        painter.put(glyph, x++, y);
+    }
+}
+
+void Text_display::line_text(std::size_t line, std::wstring& text) const {
+    const auto& info = display_state_[line];
+    const auto first = this->start_of(info);
+    auto end = first + info.length;
+    // The '\n' ending a line is not part of its length, nor the next line's.
+    if (end < contents_.size() &&
+        (line == this->last_line() ||
+         this->start_of(display_state_[line + 1]) > end)) {
+        ++end;
+    }
+    text.clear();
+    auto glyph = std::begin(contents_) + first;
+    for (auto i = first; i != end; ++i, ++glyph) {
+        text.push_back(glyph->symbol);
+    }
+}
+
+void Text_display::set_highlighter(std::unique_ptr<Highlighter> highlighter) {
+    styles_.set_highlighter(std::move(highlighter), display_state_.size());
+    this->update();
+}
+
+void Text_display::find(const Glyph_string& pattern) {
+    search_.search(contents_, pattern);
+    selected_match_ = Glyph_string::npos;
+    this->update();
+}
+
+bool Text_display::find_next() {
+    const auto& matches = search_.matches();
+    if (matches.empty()) {
+        return false;
+    }
+    auto next = std::begin(matches);
+    if (selected_match_ != Glyph_string::npos) {
+        next = std::upper_bound(std::begin(matches), std::end(matches),
+                                selected_match_);
+    } else if (this->top_line() < this->line_count()) {
+        next = std::lower_bound(std::begin(matches), std::end(matches),
+                                this->first_index_at(this->top_line()));
+    }
+    selected_match_ = next == std::end(matches) ? matches.front() : *next;
+    this->show_match(selected_match_);
+    return true;
+}
+
+bool Text_display::find_previous() {
+    const auto& matches = search_.matches();
+    if (matches.empty()) {
+        return false;
+    }
+    auto from = selected_match_;
+    if (from == Glyph_string::npos) {
+        from = this->top_line() < this->line_count()
+                   ? this->first_index_at(this->top_line())
+                   : 0;
+    }
+    const auto next =
+        std::lower_bound(std::begin(matches), std::end(matches), from);
+    selected_match_ =
+        next == std::begin(matches) ? matches.back() : *std::prev(next);
+    this->show_match(selected_match_);
+    return true;
+}
+
+void Text_display::show_match(std::size_t index) {
+    const auto line = this->line_at(index);
+    if (line < this->top_line()) {
+        this->scroll_up(this->top_line() - line);
+    } else if (line >= this->top_line() + this->height()) {
+        this->scroll_down(line - this->top_line() - this->height() + 1);
+    } else {
+        this->update();
+    }
+}
+
 void Text_display::update_display(std::size_t from_line) {
-    std::size_t begin = display_state_.at(from_line).start_index;
-    display_state_.clear();
+    const std::size_t begin = this->start_of(display_state_.at(from_line));
+    const auto old_count = display_state_.size();
+    if (from_line == 0) {
+        base_index_ = 0;
+    }
     if (this->width() == 0) {
-        display_state_.push_back(Line_info{0, 0});
-        return;
+        display_state_.clear();
+        display_state_.push_back(Line_info{base_index_, 0});
+        styles_.reset(1);
+    } else {
+        display_state_.erase(std::begin(display_state_) + from_line,
+                             std::end(display_state_));
+        wrap_lines(contents_, this->width(), this->word_wrap_enabled(), begin,
+                   [this](std::size_t start, std::size_t length) {
+                       display_state_.push_back(
+                           Line_info{start + base_index_, length});
+                       return true;
+                   });
+        styles_.replace(from_line, old_count - from_line,
+                        display_state_.size() - from_line);
     }
-    std::size_t start_index{0};
-    std::size_t length{0};
-    std::size_t last_space{0};
-    for (std::size_t i{begin}; i < contents_.size(); ++i) {
-        ++length;
-        if (this->word_wrap_enabled() && contents_.at(i).symbol == L' ') {
-            last_space = length;
-        }
-        if (contents_.at(i).symbol == L'\n') {
-            display_state_.push_back(Line_info{start_index, length - 1});
-            start_index += length;
-            length = 0;
-        } else if (length == this->width()) {
-            if (this->word_wrap_enabled() && last_space > 0) {
-                i -= length - last_space;
-                length = last_space;
-                last_space = 0;
-            }
-            display_state_.push_back(Line_info{start_index, length});
-            start_index += length;
-            length = 0;
-        }
+    if (from_line == 0) {
+        wrapped_width_ = this->width();
+        display_dirty_ = false;
     }
-    display_state_.push_back(Line_info{start_index, length});
     // Reset top_line_ if out of bounds of new display.
     if (this->top_line() >= display_state_.size()) {
         top_line_ = this->last_line();
     }
 }
 
-std::size_t Text_display::line_at(std::size_t index) const {
-    std::size_t line{0};
-    // TODO Can you binary search this?
-    for (const auto& info : display_state_) {
-        if (info.start_index <= index) {
-            ++line;
-        } else {
-            return line - 1;
+void Text_display::reflow(std::size_t index,
+                          std::size_t removed,
+                          std::size_t inserted) {
+    const auto width = this->width();
+    if (display_dirty_ || width != wrapped_width_ || width == 0) {
+        this->update_display();
+        return;
+    }
+    // Lines starting at or before index - width never look at the edit.
+    const auto first = this->line_at(index > width ? index - width : 0);
+    const auto edit_end = index + inserted;
+    auto old_line = first + 1;
+    auto resync = display_state_.size();
+    std::vector<Line_info> fresh;
+    wrap_lines(contents_, width, this->word_wrap_enabled(),
+               this->start_of(display_state_[first]),
+               [&](std::size_t start, std::size_t length) {
+                   if (start >= edit_end) {
+                       // Old start that maps to start, if lines resynchronize.
+                       const auto old_start = start - inserted + removed;
+                       while (old_line < display_state_.size() &&
+                              this->start_of(display_state_[old_line]) <
+                                  old_start) {
+                           ++old_line;
+                       }
+                       if (old_line < display_state_.size() &&
+                           this->start_of(display_state_[old_line]) ==
+                               old_start) {
+                           resync = old_line;
+                           return false;
+                       }
+                   }
+                   fresh.push_back(Line_info{start + base_index_, length});
+                   return true;
+               });
+    for (auto i = resync; i < display_state_.size(); ++i) {
+        display_state_[i].start_index =
+            display_state_[i].start_index + inserted - removed;
+    }
+    // Rewrapped lines that end before the edit and did not move keep their
+    // styles, the Glyphs they show are the same.
+    auto kept = std::size_t{0};
+    while (kept < fresh.size() && first + kept < resync) {
+        const auto& line = fresh[kept];
+        const auto& old = display_state_[first + kept];
+        if (line.start_index != old.start_index ||
+            line.length != old.length ||
+            this->start_of(line) + line.length >= index) {
+            break;
         }
+        ++kept;
+    }
+    const auto at = display_state_.erase(std::begin(display_state_) + first,
+                                         std::begin(display_state_) + resync);
+    display_state_.insert(at, std::begin(fresh), std::end(fresh));
+    styles_.replace(first + kept, resync - first - kept, fresh.size() - kept);
+    if (this->top_line() >= display_state_.size()) {
+        top_line_ = this->last_line();
     }
-    return this->last_line();
+}
+
+void Text_display::erase_front(std::size_t count) {
+    count = std::min(count, contents_.size());
+    if (count == 0) {
+        return;
+    }
+    const auto line = this->line_at(count);
+    contents_.erase(0, count);
+    if (!display_dirty_ && this->first_index_at(line) == count) {
+        display_state_.erase(std::begin(display_state_),
+                             std::begin(display_state_) + line);
+        styles_.erase_front(line);
+        base_index_ += count;
+    } else {
+        display_dirty_ = true;
+    }
+    top_line_ = top_line_ > line ? top_line_ - line : 0;
+    search_.erase_front(count);
+    if (selected_match_ != Glyph_string::npos) {
+        selected_match_ = selected_match_ >= count ? selected_match_ - count
+                                                   : Glyph_string::npos;
+    }
+    this->update();
+    contents_modified(contents_);
+}
+
+// Line start indices are strictly increasing, display_state_ is sorted.
+std::size_t Text_display::line_at(std::size_t index) const {
+    const auto after = std::upper_bound(
+        std::begin(display_state_), std::end(display_state_), index,
+        [this](std::size_t i, const Line_info& info) {
+            return i < this->start_of(info);
+        });
+    return std::distance(std::begin(display_state_), after) - 1;
 }
 
 std::size_t Text_display::display_height() const {
@@ -285,7 +565,7 @@ std::size_t Text_display::first_index_at(std::size_t line) const {
     if (line >= display_state_.size()) {
         line = display_state_.size() - 1;
     }
-    return display_state_.at(line).start_index;
+    return this->start_of(display_state_.at(line));
 }
 
 std::size_t Text_display::last_index_at(std::size_t line) const {
@@ -293,7 +573,7 @@ std::size_t Text_display::last_index_at(std::size_t line) const {
     if (next_line >= display_state_.size()) {
         return this->end_index();
     }
-    return display_state_.at(next_line).start_index;
+    return this->start_of(display_state_.at(next_line));
 }
 
 std::size_t Text_display::line_length(std::size_t line) const {
@@ -0,0 +1,158 @@
+#include <cppurses/widget/widgets/detail/text_search.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/painter/glyph_rope.hpp>
+#include <cppurses/painter/glyph_string.hpp>
+
+namespace {
+
+/// Return true if \p pattern occurs in \p text at \p index.
+bool occurs_at(const cppurses::Glyph_rope& text,
+               const std::wstring& pattern,
+               std::size_t index) {
+    if (index + pattern.size() > text.size()) {
+        return false;
+    }
+    auto at = std::begin(text) + index;
+    for (wchar_t symbol : pattern) {
+        if (at->symbol != symbol) {
+            return false;
+        }
+        ++at;
+    }
+    return true;
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+void Text_search::search(const Glyph_rope& text, const Glyph_string& pattern) {
+    auto symbols = std::wstring{};
+    symbols.reserve(pattern.size());
+    for (const Glyph& glyph : pattern) {
+        symbols.push_back(glyph.symbol);
+    }
+    const auto narrows = !pattern_.empty() &&
+                         symbols.size() > pattern_.size() &&
+                         symbols.compare(0, pattern_.size(), pattern_) == 0;
+    pattern_ = std::move(symbols);
+    if (pattern_.empty()) {
+        matches_.clear();
+        return;
+    }
+    if (!narrows) {
+        this->refresh(text);
+        return;
+    }
+    // Every match of the longer pattern is a match of the shorter one.
+    this->build_shift_table();
+    const auto end =
+        std::remove_if(std::begin(matches_), std::end(matches_),
+                       [this, &text](std::size_t index) {
+                           return !occurs_at(text, pattern_, index);
+                       });
+    matches_.erase(end, std::end(matches_));
+}
+
+void Text_search::refresh(const Glyph_rope& text) {
+    matches_.clear();
+    if (pattern_.empty()) {
+        return;
+    }
+    this->build_shift_table();
+    this->find_all(text, 0, text.size(), matches_);
+}
+
+void Text_search::clear() {
+    pattern_.clear();
+    matches_.clear();
+}
+
+void Text_search::edit(const Glyph_rope& text,
+                       std::size_t index,
+                       std::size_t removed,
+                       std::size_t inserted) {
+    if (pattern_.empty()) {
+        return;
+    }
+    // Matches starting up to pattern length - 1 before the edit overlap it.
+    const auto reach = pattern_.size() - 1;
+    const auto first_affected = index > reach ? index - reach : 0;
+    auto first = std::lower_bound(std::begin(matches_), std::end(matches_),
+                                  first_affected);
+    auto last =
+        std::lower_bound(first, std::end(matches_), index + removed);
+    for (auto it = last; it != std::end(matches_); ++it) {
+        *it = *it - removed + inserted;
+    }
+    // Found matches all start before the shifted ones, order is kept.
+    auto found = std::vector<std::size_t>{};
+    const auto window_end = std::min(index + inserted + reach, text.size());
+    this->find_all(text, first_affected, window_end, found);
+    first = matches_.erase(first, last);
+    matches_.insert(first, std::begin(found), std::end(found));
+}
+
+void Text_search::erase_front(std::size_t count) {
+    const auto first = std::lower_bound(std::begin(matches_),
+                                        std::end(matches_), count);
+    matches_.erase(std::begin(matches_), first);
+    for (auto& index : matches_) {
+        index -= count;
+    }
+}
+
+std::size_t Text_search::first_reaching(std::size_t index) const {
+    const auto reach = pattern_.size() - 1;
+    const auto start = index > reach ? index - reach : 0;
+    return std::lower_bound(std::begin(matches_), std::end(matches_), start) -
+           std::begin(matches_);
+}
+
+void Text_search::build_shift_table() {
+    // Collisions on the low byte keep the smaller, always safe, shift.
+    std::fill(std::begin(shift_), std::end(shift_), pattern_.size());
+    for (auto i = std::size_t{0}; i + 1 < pattern_.size(); ++i) {
+        shift_[pattern_[i] & 0xFF] = pattern_.size() - 1 - i;
+    }
+}
+
+void Text_search::find_all(const Glyph_rope& text,
+                           std::size_t first,
+                           std::size_t last,
+                           std::vector<std::size_t>& out) const {
+    const auto length = pattern_.size();
+    if (last < first || last - first < length) {
+        return;
+    }
+    // Iterators keep their chunk cached, so stepping rarely searches the
+    // rope. tail is the last Glyph of the window starting at at.
+    auto tail = std::begin(text) + (first + length - 1);
+    for (auto at = first; at + length <= last;) {
+        const auto symbol = tail->symbol;
+        if (symbol == pattern_.back()) {
+            auto probe = tail;
+            auto i = length - 1;
+            while (i != 0 && (--probe)->symbol == pattern_[i - 1]) {
+                --i;
+            }
+            if (i == 0) {
+                out.push_back(at);
+            }
+        }
+        const auto shift = shift_[symbol & 0xFF];
+        at += shift;
+        tail += shift;
+    }
+}
+
+}  // namespace detail
+}  // namespace cppurses
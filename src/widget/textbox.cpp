@@ -97,4 +97,19 @@ bool Textbox::mouse_press_event(const Mouse::State& mouse) {
     return Widget::mouse_press_event(mouse);
 }
 
+bool Textbox::paste_event(const Glyph_string& text) {
+    if (!takes_input_ || text.empty()) {
+        return true;
+    }
+    const auto insert_index = this->cursor_index();
+    this->insert(text, insert_index);
+    const auto cursor_index = insert_index + text.size();
+    const auto cursor_line = this->line_at(cursor_index);
+    if (cursor_line >= this->top_line() + this->height()) {
+        this->scroll_down(cursor_line - this->top_line() - this->height() + 1);
+    }
+    this->set_cursor(cursor_index);
+    return true;
+}
+
 }  // namespace cppurses
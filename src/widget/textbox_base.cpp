@@ -96,6 +96,11 @@ bool Textbox_base::resize_event(Area new_size, Area old_size) {
     return Text_display::resize_event(new_size, old_size);
 }
 
+void Textbox_base::show_match(std::size_t index) {
+    Text_display::show_match(index);
+    this->set_cursor(index);
+}
+
 void Textbox_base::increment_cursor_left() {
     auto next_index = this->cursor_index();
     if (this->cursor.position() == Point{0, 0}) {
@@ -109,7 +114,7 @@ void Textbox_base::increment_cursor_left() {
 }
 
 void Textbox_base::increment_cursor_right() {
-    if (this->cursor_index() == this->contents().size()) {
+    if (this->cursor_index() == this->contents_size()) {
         return;
     }
     auto true_last_index = this->first_index_at(this->bottom_line() + 1) - 1;
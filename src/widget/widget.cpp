@@ -4,7 +4,6 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -15,7 +14,6 @@
 #include <cppurses/painter/color.hpp>
 #include <cppurses/painter/glyph.hpp>
 #include <cppurses/system/animation_engine.hpp>
-#include <cppurses/system/events/child_event.hpp>
 #include <cppurses/system/events/delete_event.hpp>
 #include <cppurses/system/events/disable_event.hpp>
 #include <cppurses/system/events/enable_event.hpp>
@@ -26,16 +24,8 @@
 #include <cppurses/widget/border.hpp>
 #include <cppurses/widget/children_data.hpp>
 #include <cppurses/widget/cursor_data.hpp>
-
-namespace {
-std::uint16_t get_unique_id()
-{
-    static std::mutex mtx;
-    static std::uint16_t current{0};
-    std::lock_guard<std::mutex> lock{mtx};
-    return ++current;
-}
-}  // namespace
+#include <cppurses/widget/detail/widget_registry.hpp>
+#include <cppurses/widget/layout_batch.hpp>
 
 namespace cppurses {
 namespace detail {
@@ -43,19 +33,28 @@ class Screen_state;
 }  // namespace detail
 
 Widget::Widget(std::string name)
-    : name_{std::move(name)}, unique_id_{get_unique_id()}
-{}
+    : name_{std::move(name)}, unique_id_{detail::Widget_registry::next_id()}
+{
+    detail::Widget_registry::add(*this);
+}
 
 Widget::~Widget()
 {
     if (Focus::focus_widget() == this)
         Focus::clear();
     destroyed(*this);
+    detail::Widget_registry::remove(*this);
 }
 
 void Widget::set_name(std::string name)
 {
+    const std::string old_name{std::move(name_)};
     name_ = std::move(name);
+    detail::Widget_registry::rename(*this, old_name);
+    if (parent_ != nullptr) {
+        parent_->children.unindex_name(*this, old_name);
+        parent_->children.index_name(*this);
+    }
     name_changed(name_);
 }
 
@@ -132,10 +131,12 @@ void Widget::enable_and_post_events(bool enable, bool post_child_polished_event)
     if (!enable)
         System::post_event<Disable_event>(*this);
     enabled_ = enable;
+    if (this->parent() != nullptr)
+        this->parent()->children.hit_index().invalidate();
     if (enable)
         System::post_event<Enable_event>(*this);
     if (post_child_polished_event && this->parent() != nullptr)
-        System::post_event<Child_polished_event>(*this->parent(), *this);
+        Layout_batch::notify(*this->parent(), *this);
     this->update();
 }
 }  // namespace cppurses
@@ -2,6 +2,8 @@
 
 #include <cstdint>
 
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/painter/glyph_string.hpp>
 #include <cppurses/painter/painter.hpp>
 #include <cppurses/system/events/key.hpp>
 #include <cppurses/system/events/mouse.hpp>
@@ -90,6 +92,17 @@ bool Widget::key_release_event(const Key::State& keyboard)
     return false;
 }
 
+bool Widget::paste_event(const Glyph_string& text)
+{
+    for (const Glyph& glyph : text) {
+        if (glyph.symbol > 0x7F)
+            continue;
+        const auto code = static_cast<Key::Code>(glyph.symbol);
+        this->key_press_event(Key::State{code, key_to_char(code)});
+    }
+    return true;
+}
+
 bool Widget::focus_in_event()
 {
     focused_in();
@@ -197,6 +210,12 @@ bool Widget::key_release_event_filter(Widget& /* receiver */,
     return false;
 }
 
+bool Widget::paste_event_filter(Widget& /* receiver */,
+                                const Glyph_string& /* text */)
+{
+    return false;
+}
+
 bool Widget::focus_in_event_filter(Widget& /* receiver */) { return false; }
 
 bool Widget::focus_out_event_filter(Widget& /* receiver */) { return false; }
@@ -0,0 +1,78 @@
+#include <cppurses/widget/detail/widget_registry.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <cppurses/widget/widget.hpp>
+
+namespace cppurses {
+namespace detail {
+
+std::uint64_t Widget_registry::next_id() {
+    static std::atomic<std::uint64_t> current{0};
+    return current.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+void Widget_registry::add(Widget& w) {
+    std::lock_guard<std::mutex> lock{mutex()};
+    widgets().emplace(w.unique_id(), &w);
+    if (!w.name().empty()) {
+        names().emplace(w.name(), &w);
+    }
+}
+
+void Widget_registry::remove(const Widget& w) {
+    std::lock_guard<std::mutex> lock{mutex()};
+    widgets().erase(w.unique_id());
+    erase_name(w.name(), w);
+}
+
+void Widget_registry::rename(Widget& w, const std::string& old_name) {
+    std::lock_guard<std::mutex> lock{mutex()};
+    erase_name(old_name, w);
+    if (!w.name().empty()) {
+        names().emplace(w.name(), &w);
+    }
+}
+
+Widget* Widget_registry::find(std::uint64_t id) {
+    std::lock_guard<std::mutex> lock{mutex()};
+    auto at = widgets().find(id);
+    return at == widgets().end() ? nullptr : at->second;
+}
+
+// Function local statics, so Widgets with static storage duration can be
+// registered before main() and are destroyed before the registry is.
+std::mutex& Widget_registry::mutex() {
+    static std::mutex mtx;
+    return mtx;
+}
+
+std::unordered_map<std::uint64_t, Widget*>& Widget_registry::widgets() {
+    static std::unordered_map<std::uint64_t, Widget*> map;
+    return map;
+}
+
+std::unordered_multimap<std::string, Widget*>& Widget_registry::names() {
+    static std::unordered_multimap<std::string, Widget*> map;
+    return map;
+}
+
+void Widget_registry::erase_name(const std::string& name, const Widget& w) {
+    if (name.empty()) {
+        return;
+    }
+    auto range = names().equal_range(name);
+    for (auto at = range.first; at != range.second; ++at) {
+        if (at->second == &w) {
+            names().erase(at);
+            return;
+        }
+    }
+}
+
+}  // namespace detail
+}  // namespace cppurses
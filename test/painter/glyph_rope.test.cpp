@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/painter/glyph_rope.hpp>
+#include <cppurses/painter/glyph_string.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+auto make_text(std::size_t size, wchar_t first) -> Glyph_string {
+    auto text = Glyph_string{};
+    for (auto i = std::size_t{0}; i < size; ++i) {
+        text.append(Glyph{static_cast<wchar_t>(first + i % 26)});
+    }
+    return text;
+}
+
+}  // namespace
+
+TEST(GlyphRope, MatchesGlyphString) {
+    auto gen = std::mt19937{3};
+    auto expected = make_text(3000, L'a');
+    auto rope = Glyph_rope{expected};
+    for (auto step = 0; step < 2000; ++step) {
+        const auto index =
+            std::uniform_int_distribution<std::size_t>{0, expected.size()}(gen);
+        const auto count =
+            std::uniform_int_distribution<std::size_t>{0, 700}(gen);
+        if (std::uniform_int_distribution<int>{0, 1}(gen) == 0) {
+            const auto text = make_text(count, L'A');
+            expected.insert(std::begin(expected) + index, std::begin(text),
+                            std::end(text));
+            rope.insert(index, text);
+        } else {
+            const auto end = std::min(index + count, expected.size());
+            expected.erase(std::begin(expected) + index,
+                           std::begin(expected) + end);
+            rope.erase(index, count);
+        }
+        ASSERT_EQ(expected.size(), rope.size());
+    }
+    EXPECT_EQ(expected, rope.glyph_string());
+    EXPECT_EQ(expected, Glyph_string(std::begin(rope), std::end(rope)));
+    for (auto i = std::size_t{0}; i < expected.size(); i += 97) {
+        EXPECT_EQ(expected[i], rope[i]);
+        EXPECT_EQ(expected[i], *(std::begin(rope) + i));
+        EXPECT_EQ(Glyph_string(std::begin(expected) + i, std::end(expected)),
+                  rope.substr(i));
+    }
+}
+
+TEST(GlyphRope, CopiesAreSnapshots) {
+    auto rope = Glyph_rope{make_text(2000, L'a')};
+    const auto snapshot = rope;
+    rope.erase(10, 1500);
+    rope.insert(5, Glyph_string{"xyz"});
+    rope.pop_back();
+    EXPECT_EQ(2000, snapshot.size());
+    EXPECT_EQ(make_text(2000, L'a'), snapshot.glyph_string());
+    EXPECT_EQ(L'x', rope[5].symbol);
+    EXPECT_EQ(502, rope.size());
+}
+
+TEST(GlyphRope, ChunksCoverRangeWithoutCopy) {
+    auto rope = Glyph_rope{make_text(1500, L'a')};
+    rope.insert(700, make_text(40, L'A'));
+    const auto expected = rope.substr(300, 1000);
+    auto joined = Glyph_string{};
+    for (auto index = std::size_t{300}; joined.size() < 1000;) {
+        const auto run = rope.chunk_at(index, 1000 - joined.size());
+        ASSERT_FALSE(run.empty());
+        joined.append(run.glyph_string());
+        index += run.size();
+    }
+    EXPECT_EQ(expected, joined);
+    EXPECT_TRUE(rope.chunk_at(rope.size()).empty());
+}
+
+TEST(GlyphRope, BoundsChecking) {
+    auto rope = Glyph_rope{Glyph_string{"abc"}};
+    EXPECT_THROW(rope.at(3), std::out_of_range);
+    EXPECT_THROW(rope.insert(4, Glyph_string{"x"}), std::out_of_range);
+    EXPECT_THROW(rope.erase(4), std::out_of_range);
+    rope.erase(1);
+    EXPECT_EQ("a", rope.str());
+    rope.clear();
+    EXPECT_TRUE(rope.empty());
+    EXPECT_EQ(std::begin(rope), std::end(rope));
+}
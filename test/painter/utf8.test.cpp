@@ -0,0 +1,39 @@
+#include <cstddef>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/painter/utility/utf8.hpp>
+#include <cppurses/painter/utility/wchar_to_bytes.hpp>
+
+using namespace cppurses;
+using utility::bytes_to_wchar;
+using utility::wchar_to_bytes;
+
+TEST(Utf8, RoundTripsMixedText) {
+    auto gen = std::mt19937{5};
+    const wchar_t samples[] = {L'a', L'~', L'é', L'─', L'█', L'𝄞', L'\n'};
+    for (auto length : {0, 1, 7, 15, 16, 17, 33, 200}) {
+        auto text = std::wstring{};
+        for (auto i = 0; i < length; ++i) {
+            // Mostly ASCII, so both the bulk and the single paths are used.
+            const auto pick = std::uniform_int_distribution<int>{0, 19}(gen);
+            text.push_back(pick < 7 ? samples[pick] : L'a' + pick);
+        }
+        EXPECT_EQ(text, bytes_to_wchar(wchar_to_bytes(text)));
+    }
+    EXPECT_EQ("\xC3\xA9\xF0\x9D\x84\x9E", wchar_to_bytes(L"é𝄞"));
+}
+
+TEST(Utf8, InvalidSequencesAreReplaced) {
+    // Stray continuation, overlong, surrogate, past U+10FFFF, truncated.
+    EXPECT_EQ(L"a�b", bytes_to_wchar("a\x80" "b"));
+    EXPECT_EQ(L"��", bytes_to_wchar("\xC0\xAF"));
+    EXPECT_EQ(L"���", bytes_to_wchar("\xED\xA0\x80"));
+    EXPECT_EQ(L"����", bytes_to_wchar("\xF4\x90\x80\x80"));
+    EXPECT_EQ(L"0123456789abcdef�", bytes_to_wchar("0123456789abcdef\xE2\x82"));
+    EXPECT_EQ("\xEF\xBF\xBD", wchar_to_bytes(static_cast<wchar_t>(0xD800)));
+    EXPECT_EQ(std::string("a\0b", 3), Glyph_string{std::string("a\0b", 3)}.str());
+}
@@ -7,6 +7,7 @@
 #include <cppurses/system/event.hpp>
 #include <cppurses/system/events/delete_event.hpp>
 #include <cppurses/system/events/focus_event.hpp>
+#include <cppurses/system/events/mouse.hpp>
 #include <cppurses/system/events/paint_event.hpp>
 #include <cppurses/widget/widgets/push_button.hpp>
 
@@ -225,3 +226,23 @@ TEST(EventQueue, RemoveEventsOf)
     }
     EXPECT_TRUE(paint_count == 1);
 }
+
+TEST(EventQueue, MouseMoveCoalesced)
+{
+    auto move_to = [](std::size_t x) {
+        return std::make_unique<Mouse::Move>(
+            get_widg(), Mouse::State{Mouse::Button::None, {x, 0}, {x, 0}, 0});
+    };
+    Event_queue queue{};
+    queue.append(move_to(1));
+    queue.append(move_to(2));
+    queue.append(move_to(3));
+    queue.append(make_event(Event::None));
+    queue.append(move_to(4));
+
+    auto general_count = 0;
+    for (std::unique_ptr<Event> event : General_view{queue}) {
+        ++general_count;
+    }
+    EXPECT_TRUE(general_count == 3);  // Moves before the Focus_in_event merge.
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <cppurses/system/focus.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/terminal/headless_screen.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/focus_policy.hpp>
+#include <cppurses/widget/widget.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+auto make_focusable(Widget& parent) -> Widget&
+{
+    auto& child        = parent.make_child<Widget>();
+    child.focus_policy = Focus_policy::Strong;
+    return child;
+}
+
+}  // namespace
+
+TEST(Focus, TabFollowsTreeOrderAndSeesChanges)
+{
+    Headless_screen screen{Area{10, 3}};
+    System::terminal.use_headless(&screen);
+    System::terminal.initialize();
+    Widget head;
+    auto& group = head.make_child<Widget>();
+    auto& a     = make_focusable(group);
+    auto& b     = make_focusable(head);
+    auto& a1    = make_focusable(a);
+    System::set_head(&head);
+
+    Focus::set_focus_to(a);
+    EXPECT_TRUE(Focus::tab_press());
+    EXPECT_EQ(&a1, Focus::focus_widget());
+    Focus::tab_press();
+    EXPECT_EQ(&b, Focus::focus_widget());
+    Focus::tab_press();
+    EXPECT_EQ(&a, Focus::focus_widget());
+    Focus::shift_tab_press();
+    EXPECT_EQ(&b, Focus::focus_widget());
+
+    // Policy and enabled changes apply on the next press.
+    a1.focus_policy = Focus_policy::None;
+    Focus::shift_tab_press();
+    EXPECT_EQ(&a, Focus::focus_widget());
+    b.disable();
+    Focus::tab_press();
+    EXPECT_EQ(&a, Focus::focus_widget());
+
+    // So do Widgets added after the chain was built.
+    auto& c = make_focusable(head);
+    Focus::tab_press();
+    EXPECT_EQ(&c, Focus::focus_widget());
+
+    Focus::clear();
+    System::set_head(nullptr);
+    System::terminal.uninitialize();
+    System::terminal.use_headless(nullptr);
+}
+
+TEST(Focus, TabSkipsDisabledSubtrees)
+{
+    Headless_screen screen{Area{10, 3}};
+    System::terminal.use_headless(&screen);
+    System::terminal.initialize();
+    Widget head;
+    auto& first  = make_focusable(head);
+    auto& hidden = head.make_child<Widget>();
+    auto& inner  = make_focusable(hidden);
+    make_focusable(inner);
+    auto& last = make_focusable(head);
+    System::set_head(&head);
+    hidden.disable();
+    // Enabled again, but still under a disabled parent.
+    inner.enable();
+
+    Focus::set_focus_to(first);
+    Focus::tab_press();
+    EXPECT_EQ(&last, Focus::focus_widget());
+    Focus::shift_tab_press();
+    EXPECT_EQ(&first, Focus::focus_widget());
+    Focus::shift_tab_press();
+    EXPECT_EQ(&last, Focus::focus_widget());
+
+    hidden.enable();
+    Focus::shift_tab_press();
+    EXPECT_NE(&last, Focus::focus_widget());
+    EXPECT_EQ(&hidden, Focus::focus_widget()->parent()->parent());
+
+    Focus::clear();
+    System::set_head(nullptr);
+    System::terminal.uninitialize();
+    System::terminal.use_headless(nullptr);
+}
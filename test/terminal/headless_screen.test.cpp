@@ -0,0 +1,84 @@
+#include <chrono>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <cppurses/painter/color.hpp>
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/system/event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/terminal/headless_screen.hpp>
+#include <cppurses/terminal/input.hpp>
+#include <cppurses/terminal/input_record.hpp>
+#include <cppurses/terminal/output.hpp>
+#include <cppurses/widget/widget.hpp>
+
+using namespace cppurses;
+
+TEST(HeadlessScreen, OutputIsWrittenToGrid)
+{
+    Headless_screen screen{Area{10, 3}};
+    System::terminal.use_headless(&screen);
+    System::terminal.initialize();
+    EXPECT_EQ(10, System::terminal.width());
+    EXPECT_EQ(3, System::terminal.height());
+
+    output::put(2, 1, Glyph{L'a'});
+    output::put(Glyph{L'é'});
+    output::put(9, 1, Glyph{L'z', foreground(Color::Red)});
+    output::put(Glyph{L'w'});  // Wraps to the next line.
+    output::put(0, 5, Glyph{L'x'});  // Off screen, dropped.
+    output::refresh();
+
+    EXPECT_EQ(L"  aé     z", screen.row(1));
+    EXPECT_EQ(L"w         ", screen.row(2));
+    EXPECT_EQ(Color::Red, *screen.at(9, 1).brush.foreground_color());
+
+    const auto stats = screen.stats();
+    EXPECT_EQ(4, stats.cells);
+    EXPECT_EQ(4, stats.cells_changed);
+    EXPECT_EQ(1, stats.refreshes);
+    // "\e[2;3H" "\e[0m" "a" "é" "\e[2;10H" "\e[0;3Nm" "z" "\e[0m" "w"
+    EXPECT_EQ(6 + 4 + 1 + 2 + 7 + 7 + 1 + 4 + 1, stats.bytes);
+
+    screen.reset_stats();
+    output::put(2, 1, Glyph{L'a'});
+    EXPECT_EQ(1, screen.stats().cells);
+    EXPECT_EQ(0, screen.stats().cells_changed);
+
+    System::terminal.uninitialize();
+    System::terminal.use_headless(nullptr);
+}
+
+TEST(HeadlessScreen, InjectedInputIsRead)
+{
+    Headless_screen screen{Area{10, 3}};
+    System::terminal.use_headless(&screen);
+    System::terminal.initialize();
+    Widget head;
+    System::set_head(&head);
+
+    EXPECT_EQ(nullptr, input::get());
+
+    screen.resize(Area{20, 5});
+    EXPECT_EQ(20, System::terminal.width());
+    auto event = input::get();
+    ASSERT_NE(nullptr, event);
+    EXPECT_EQ(Event::Resize, event->type());
+    EXPECT_EQ(&head, &event->receiver());
+
+    auto key = Input_record{};
+    key.kind = Input_record::Kind::Key;
+    key.key  = 'a';
+    screen.inject(key);
+    screen.resize(Area{30, 5});
+    screen.resize(Area{40, 5});
+    // Text is batched, a Resize ends the batch and is read on its own.
+    EXPECT_EQ(0, input::get_pending().size());  // No focus Widget for the key.
+    EXPECT_EQ(1, input::get_pending().size());
+    EXPECT_EQ(1, input::get_pending().size());
+
+    System::set_head(nullptr);
+    System::terminal.uninitialize();
+    System::terminal.use_headless(nullptr);
+}
@@ -0,0 +1,114 @@
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cppurses/system/event.hpp>
+#include <cppurses/system/events/mouse.hpp>
+#include <cppurses/terminal/input_record.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+auto key_record(int key, bool batched) -> Input_record
+{
+    auto record    = Input_record{};
+    record.kind    = Input_record::Kind::Key;
+    record.key     = key;
+    record.batched = batched;
+    record.delay   = batched ? 0 : 1'234'567;
+    return record;
+}
+
+}  // namespace
+
+TEST(InputRecord, RoundTrip)
+{
+    auto records = std::vector<Input_record>{};
+    records.push_back(key_record('a', false));
+    records.push_back(key_record(0x1FF, true));
+
+    auto mouse       = Input_record{};
+    mouse.kind       = Input_record::Kind::Mouse;
+    mouse.mouse_type = Event::MouseMove;
+    mouse.button     = Mouse::Button::Left;
+    mouse.position   = Point{300, 70};
+    mouse.device_id  = 2;
+    records.push_back(mouse);
+
+    auto resize = Input_record{};
+    resize.kind = Input_record::Kind::Resize;
+    resize.area = Area{120, 40};
+    records.push_back(resize);
+
+    auto paste = Input_record{};
+    paste.kind = Input_record::Kind::Paste;
+    paste.text = "line one\nline \xC3\xA9 two";
+    records.push_back(paste);
+
+    auto stream = std::stringstream{};
+    write_record_header(stream);
+    for (const auto& record : records)
+        write_record(stream, record);
+
+    ASSERT_TRUE(read_record_header(stream));
+    auto record = Input_record{};
+    for (const auto& expected : records) {
+        ASSERT_TRUE(read_record(stream, record));
+        EXPECT_EQ(expected.kind, record.kind);
+        EXPECT_EQ(expected.batched, record.batched);
+        EXPECT_EQ(expected.delay, record.delay);
+        EXPECT_EQ(expected.key, record.key);
+        EXPECT_EQ(expected.mouse_type, record.mouse_type);
+        EXPECT_EQ(expected.button, record.button);
+        EXPECT_EQ(expected.position, record.position);
+        EXPECT_EQ(expected.device_id, record.device_id);
+        EXPECT_EQ(expected.area.width, record.area.width);
+        EXPECT_EQ(expected.area.height, record.area.height);
+        EXPECT_EQ(expected.text, record.text);
+    }
+    EXPECT_FALSE(read_record(stream, record));
+}
+
+TEST(InputRecord, RejectsBadInput)
+{
+    auto not_a_recording = std::stringstream{"CPUR\x01"};
+    EXPECT_FALSE(read_record_header(not_a_recording));
+
+    auto truncated = std::stringstream{};
+    write_record(truncated, key_record(1000, false));
+    auto bytes = truncated.str();
+    bytes.pop_back();
+    auto input = std::stringstream{bytes};
+    auto record = Input_record{};
+    EXPECT_FALSE(read_record(input, record));
+}
+
+TEST(InputRecord, RejectsCorruptPasteSize)
+{
+    // A Paste claiming far more text than the stream holds.
+    auto corrupt = std::stringstream{};
+    write_record_header(corrupt);
+    corrupt.put(static_cast<char>(Input_record::Kind::Paste));
+    corrupt.put(0);  // delay
+    for (auto i = 0; i < 8; ++i)
+        corrupt.put(static_cast<char>(0xFF));
+    corrupt.put(0x7F);  // size varint, close to 2^63
+    corrupt << "short";
+    ASSERT_TRUE(read_record_header(corrupt));
+    auto record = Input_record{};
+    EXPECT_FALSE(read_record(corrupt, record));
+
+    // Within the size limit, but truncated.
+    auto truncated = std::stringstream{};
+    auto paste     = Input_record{};
+    paste.kind     = Input_record::Kind::Paste;
+    paste.text     = std::string(10'000, 'x');
+    write_record(truncated, paste);
+    auto bytes = truncated.str();
+    bytes.resize(bytes.size() - 100);
+    auto input = std::stringstream{bytes};
+    EXPECT_FALSE(read_record(input, record));
+}
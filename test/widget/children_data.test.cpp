@@ -0,0 +1,79 @@
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cppurses/widget/children_data.hpp>
+#include <cppurses/widget/widget.hpp>
+
+using namespace cppurses;
+
+TEST(ChildrenData, HasDescendantAtAnyDepth) {
+    Widget root;
+    Widget* level = &root;
+    for (int i{0}; i < 6; ++i) {
+        level = &level->make_child<Widget>();
+    }
+    Widget& other = root.make_child<Widget>();
+    EXPECT_TRUE(root.children.has_descendant(level));
+    EXPECT_FALSE(other.children.has_descendant(level));
+    EXPECT_FALSE(level->children.has_descendant(&root));
+    EXPECT_FALSE(root.children.has_descendant(&root));
+}
+
+TEST(ChildrenData, DescendantsArePreorderAndCached) {
+    Widget root;
+    Widget& a = root.make_child<Widget>();
+    Widget& a1 = a.make_child<Widget>();
+    Widget& b = root.make_child<Widget>();
+    const std::vector<Widget*> expected{&a, &a1, &b};
+    EXPECT_EQ(expected, root.children.descendants());
+
+    // Unchanged trees reuse the same storage.
+    const auto* data = root.children.descendants().data();
+    EXPECT_EQ(data, root.children.descendants().data());
+
+    // A change anywhere below is seen.
+    Widget& b1 = b.make_child<Widget>();
+    const std::vector<Widget*> grown{&a, &a1, &b, &b1};
+    EXPECT_EQ(grown, root.children.descendants());
+
+    auto removed = a.children.remove(&a1);
+    const std::vector<Widget*> pruned{&a, &b, &b1};
+    EXPECT_EQ(pruned, root.children.descendants());
+
+    // Changes outside a subtree leave its generation alone.
+    const auto b_generation = b.children.subtree_generation();
+    const auto root_generation = root.children.subtree_generation();
+    a.make_child<Widget>();
+    EXPECT_EQ(b_generation, b.children.subtree_generation());
+    EXPECT_NE(root_generation, root.children.subtree_generation());
+}
+
+TEST(ChildrenData, NameIndexFollowsRenamesAndRemovals) {
+    Widget root;
+    Widget& a = root.make_child<Widget>("a");
+    Widget& b = a.make_child<Widget>("b");
+    Widget& twin1 = root.make_child<Widget>("twin");
+    root.make_child<Widget>("twin");
+    EXPECT_EQ(&a, root.find_child("a"));
+    EXPECT_EQ(nullptr, root.find_child("b"));
+    EXPECT_EQ(&b, root.find_descendant("b"));
+    EXPECT_EQ(&twin1, root.find_child("twin"));
+    EXPECT_EQ(nullptr, a.find_descendant("twin"));
+
+    b.set_name("c");
+    EXPECT_EQ(nullptr, root.find_descendant("b"));
+    EXPECT_EQ(&b, root.find_descendant("c"));
+    EXPECT_TRUE(root.children.has_descendant("c"));
+    a.set_name("twin");
+    EXPECT_FALSE(root.children.has("a"));
+    EXPECT_EQ(&a, root.find_child("twin"));
+
+    auto removed = root.children.remove("twin");
+    EXPECT_EQ(&a, removed.get());
+    EXPECT_EQ(nullptr, root.find_descendant("c"));
+    EXPECT_EQ(&twin1, root.find_child("twin"));
+    removed.reset();
+    EXPECT_FALSE(root.children.has_descendant("c"));
+}
@@ -0,0 +1,122 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/widgets/file_viewer.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+/// Writes a file of numbered lines, removed when destroyed.
+class Numbered_file {
+   public:
+    explicit Numbered_file(std::size_t lines) {
+        std::ofstream file{name};
+        for (auto i = std::size_t{0}; i < lines; ++i) {
+            file << "line " << i << (i % 3 == 0 ? " caf\xC3\xA9\r\n" : "\n");
+        }
+    }
+
+    ~Numbered_file() { std::remove(name.c_str()); }
+
+    const std::string name{"file_viewer.test.txt"};
+};
+
+/// File_viewer sized to 20x3.
+class Small_viewer : public File_viewer {
+   public:
+    explicit Small_viewer(const std::string& filename)
+        : File_viewer{filename} {
+        this->enable();
+        System::send_event(Resize_event{*this, Area{20, 3}});
+    }
+};
+
+void wait_for_index(const File_viewer& viewer) {
+    while (!viewer.index_complete()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+}
+
+}  // namespace
+
+TEST(FileViewer, DisplaysAndScrollsLines) {
+    const Numbered_file file{5000};
+    Small_viewer viewer{file.name};
+    EXPECT_EQ(L"line 0 café\nline 1\nline 2",
+              std::wstring{viewer.contents().w_str()});
+    viewer.scroll_down(2);
+    EXPECT_EQ(2, viewer.top_file_line());
+    EXPECT_EQ("line 2\nline 3 caf", viewer.contents().str().substr(0, 17));
+    viewer.scroll_up(5);
+    EXPECT_EQ(0, viewer.top_file_line());
+    wait_for_index(viewer);
+    EXPECT_EQ(5000, viewer.file_line_count());
+    viewer.go_to_line(3001);
+    EXPECT_EQ("line 3001\nline 3002", viewer.contents().str().substr(0, 19));
+    viewer.go_to_line(100000);
+    EXPECT_EQ(4999, viewer.top_file_line());
+    EXPECT_EQ("line 4999", viewer.contents().str());
+    viewer.scroll_down(1);
+    EXPECT_EQ(4999, viewer.top_file_line());
+}
+
+TEST(FileViewer, InvalidUtf8IsReplaced) {
+    {
+        std::ofstream file{"file_viewer.invalid.txt"};
+        file << "a\xFF" << "b\xE2\x82";
+    }
+    Small_viewer viewer{"file_viewer.invalid.txt"};
+    std::remove("file_viewer.invalid.txt");
+    EXPECT_EQ(L"a�b�", viewer.contents().w_str());
+    EXPECT_THROW(viewer.open("file_viewer.missing.txt"), std::runtime_error);
+    EXPECT_EQ(0, viewer.file_size());
+}
+
+TEST(FileViewer, LongLinesAreCutByCharacters) {
+    {
+        // 100 two byte characters, more bytes than the 20x3 limit of 60.
+        std::ofstream file{"file_viewer.long.txt"};
+        for (auto i = 0; i < 100; ++i) {
+            file << "\xC3\xA9";
+        }
+    }
+    Small_viewer viewer{"file_viewer.long.txt"};
+    std::remove("file_viewer.long.txt");
+    EXPECT_EQ(std::wstring(60, L'\u00E9'), viewer.contents().w_str());
+}
+
+TEST(FileViewer, UnbrokenFileScrollsInPieces) {
+    {
+        // 8 MB with no newline, a 20x3 view shows 60 characters of each piece.
+        std::ofstream file{"file_viewer.unbroken.txt"};
+        const std::string pattern{"0123456"};
+        for (auto i = 0; i < 8 * 1024 * 1024 / 7; ++i) {
+            file << pattern;
+        }
+    }
+    Small_viewer viewer{"file_viewer.unbroken.txt"};
+    std::remove("file_viewer.unbroken.txt");
+    const auto first = viewer.contents().str();
+    EXPECT_EQ(3 * 60 + 2, first.size());
+    EXPECT_EQ("0123456012", first.substr(0, 10));
+
+    // Pieces are 240 bytes, four per character.
+    viewer.scroll_down(1);
+    EXPECT_EQ(0, viewer.top_file_line());
+    EXPECT_EQ("2345601234", viewer.contents().str().substr(0, 10));
+    viewer.scroll_down(1000);
+    EXPECT_EQ(0, viewer.top_file_line());
+    viewer.scroll_up(1001);
+    EXPECT_EQ(first, viewer.contents().str());
+}
@@ -0,0 +1,88 @@
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cppurses/system/detail/event_engine.hpp>
+#include <cppurses/system/detail/event_queue.hpp>
+#include <cppurses/system/detail/find_widget_at.hpp>
+#include <cppurses/system/event.hpp>
+#include <cppurses/system/events/move_event.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/terminal/headless_screen.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/widget.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+/// Drop queued Events, nothing here needs them delivered.
+void discard_events() {
+    auto& queue = detail::Event_engine::get().queue();
+    for (std::unique_ptr<Event> event :
+         detail::Event_queue::View<Event::None>{queue}) {
+    }
+    for (std::unique_ptr<Event> event :
+         detail::Event_queue::View<Event::Paint>{queue}) {
+    }
+    queue.clean();
+}
+
+void set_geometry(Widget& w, Point position, Area size) {
+    System::send_event(Move_event{w, position});
+    System::send_event(Resize_event{w, size});
+}
+
+}  // namespace
+
+TEST(HitIndex, FollowsMovesResizesRemovalsAndDisables) {
+    discard_events();
+    Headless_screen screen{Area{40, 4}};
+    System::terminal.use_headless(&screen);
+    System::terminal.initialize();
+    Widget head;
+    std::vector<Widget*> row;
+    // Enough children for the indexed path, each 2 wide along one line.
+    for (std::size_t i{0}; i < 12; ++i) {
+        row.push_back(&head.make_child<Widget>());
+    }
+    head.enable();
+    set_geometry(head, Point{0, 0}, Area{40, 4});
+    for (std::size_t i{0}; i < row.size(); ++i) {
+        set_geometry(*row[i], Point{2 * i, 0}, Area{2, 1});
+    }
+    System::set_head(&head);
+    EXPECT_EQ(row[0], detail::find_widget_at(1, 0));
+    EXPECT_EQ(row[5], detail::find_widget_at(10, 0));
+    EXPECT_EQ(&head, detail::find_widget_at(30, 0));
+    EXPECT_EQ(&head, detail::find_widget_at(10, 1));
+
+    // Move the last child past the others.
+    System::send_event(Move_event{*row[11], Point{30, 0}});
+    EXPECT_EQ(&head, detail::find_widget_at(22, 0));
+    EXPECT_EQ(row[11], detail::find_widget_at(31, 0));
+
+    // Resize a child to cover more of the line.
+    System::send_event(Resize_event{*row[11], Area{6, 1}});
+    EXPECT_EQ(row[11], detail::find_widget_at(35, 0));
+
+    // Remove a child, its cells belong to the head.
+    auto removed = head.children.remove(row[5]);
+    EXPECT_EQ(&head, detail::find_widget_at(10, 0));
+    EXPECT_EQ(row[6], detail::find_widget_at(12, 0));
+
+    // Disabled children own nothing.
+    row[6]->disable();
+    EXPECT_EQ(&head, detail::find_widget_at(12, 0));
+    EXPECT_EQ(row[7], detail::find_widget_at(14, 0));
+
+    removed.reset();
+    System::set_head(nullptr);
+    System::terminal.uninitialize();
+    System::terminal.use_headless(nullptr);
+    discard_events();
+}
@@ -0,0 +1,277 @@
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cppurses/system/detail/event_engine.hpp>
+#include <cppurses/system/detail/event_queue.hpp>
+#include <cppurses/system/event.hpp>
+#include <cppurses/system/events/child_event.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/detail/share_space.hpp>
+#include <cppurses/widget/layout_batch.hpp>
+#include <cppurses/widget/layouts/grid.hpp>
+#include <cppurses/widget/layouts/horizontal.hpp>
+#include <cppurses/widget/layouts/vertical.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/widget.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+/// Counts the Move and Resize events it handles.
+class Probe : public Widget {
+   public:
+    std::size_t moves{0};
+    std::size_t resizes{0};
+
+   protected:
+    bool move_event(Point new_position, Point old_position) override {
+        ++moves;
+        return Widget::move_event(new_position, old_position);
+    }
+
+    bool resize_event(Area new_size, Area old_size) override {
+        ++resizes;
+        return Widget::resize_event(new_size, old_size);
+    }
+};
+
+/// Asks for a height of 7 the first time it is resized.
+class Grows_once : public Widget {
+   protected:
+    bool resize_event(Area new_size, Area old_size) override {
+        if (!grown_) {
+            grown_ = true;
+            this->height_policy.fixed(7);
+        }
+        return Widget::resize_event(new_size, old_size);
+    }
+
+   private:
+    bool grown_{false};
+};
+
+/// Send every posted Event, other than Paint and Delete Events.
+void process_events() {
+    auto& queue = detail::Event_engine::get().queue();
+    for (std::unique_ptr<Event> event :
+         detail::Event_queue::View<Event::None>{queue}) {
+        System::send_event(*event);
+    }
+    queue.clean();
+}
+
+/// Return the number of Child_polished_events waiting in the queue.
+std::size_t count_polished() {
+    auto& queue = detail::Event_engine::get().queue();
+    std::vector<std::unique_ptr<Event>> events;
+    for (std::unique_ptr<Event> event :
+         detail::Event_queue::View<Event::None>{queue}) {
+        events.push_back(std::move(event));
+    }
+    queue.clean();
+    std::size_t count{0};
+    for (std::unique_ptr<Event>& event : events) {
+        if (event->type() == Event::ChildPolished) {
+            ++count;
+        }
+        System::post_event(std::move(event));
+    }
+    return count;
+}
+
+/// Drop Events left by earlier tests, their receivers may no longer exist.
+void discard_events() {
+    auto& queue = detail::Event_engine::get().queue();
+    for (std::unique_ptr<Event> event :
+         detail::Event_queue::View<Event::None>{queue}) {
+    }
+    queue.clean();
+}
+
+}  // namespace
+
+TEST(Layout, SkipsPassWhenInputsUnchanged) {
+    discard_events();
+    layout::Vertical layout;
+    auto& top = layout.make_child<Probe>();
+    auto& bottom = layout.make_child<Probe>();
+    layout.enable();
+    System::send_event(Resize_event{layout, Area{10, 10}});
+    process_events();
+    EXPECT_EQ(5, top.height());
+    EXPECT_EQ(5, bottom.height());
+    EXPECT_EQ(5, bottom.y());
+
+    // A child polishing itself without a change posts nothing.
+    top.resizes = bottom.resizes = 0;
+    top.moves = bottom.moves = 0;
+    System::send_event(Child_polished_event{layout, top});
+    process_events();
+    EXPECT_EQ(0, top.resizes + bottom.resizes + top.moves + bottom.moves);
+
+    // Only the children whose geometry changes receive events.
+    top.height_policy.fixed(3);
+    process_events();
+    EXPECT_EQ(3, top.height());
+    EXPECT_EQ(7, bottom.height());
+    EXPECT_EQ(3, bottom.y());
+    EXPECT_EQ(0, top.moves);
+    EXPECT_EQ(1, top.resizes);
+    EXPECT_EQ(1, bottom.moves);
+}
+
+TEST(Layout, HiddenChildReturnsWhenThereIsSpace) {
+    discard_events();
+    layout::Horizontal layout;
+    auto& left = layout.make_child<Probe>();
+    auto& right = layout.make_child<Probe>();
+    left.width_policy.fixed(6);
+    right.width_policy.fixed(6);
+    layout.enable();
+    System::send_event(Resize_event{layout, Area{8, 2}});
+    process_events();
+    EXPECT_TRUE(left.enabled());
+    EXPECT_FALSE(right.enabled());
+
+    System::send_event(Resize_event{layout, Area{12, 2}});
+    process_events();
+    EXPECT_TRUE(right.enabled());
+    EXPECT_EQ(6, right.x());
+    EXPECT_EQ(6, right.width());
+}
+
+TEST(Layout, NestedLayoutHiddenBeforeItsEventsArriveIsRedone) {
+    discard_events();
+    layout::Vertical parent;
+    auto& sibling = parent.make_child<Grows_once>();
+    auto& nested = parent.make_child<layout::Vertical>();
+    auto& child = nested.make_child<Widget>();
+    sibling.height_policy.fixed(2);
+    nested.height_policy.fixed(5);
+    parent.enable();
+    System::send_event(Resize_event{parent, Area{10, 8}});
+    process_events();
+    // The sibling grew, hiding nested before child's events were delivered.
+    EXPECT_FALSE(nested.enabled());
+
+    sibling.height_policy.fixed(2);
+    process_events();
+    EXPECT_TRUE(child.enabled());
+    EXPECT_EQ(10, child.width());
+    EXPECT_EQ(5, child.height());
+    EXPECT_EQ(0, child.x());
+    EXPECT_EQ(2, child.y());
+}
+
+TEST(Layout, ShareSpaceIsExactAndDeterministic) {
+    using detail::Share;
+    // The first Share fills, the rest is split 1:2, the remainder of 1 goes
+    // to the larger fraction.
+    std::vector<Share> shares{Share{1, 2, 0}, Share{1, 100, 0},
+                              Share{2, 100, 0}};
+    EXPECT_EQ(0, detail::share_space(shares, 12));
+    EXPECT_EQ(2, shares[0].amount);
+    EXPECT_EQ(3, shares[1].amount);
+    EXPECT_EQ(7, shares[2].amount);
+
+    // Equal fractions, earlier Shares win the remainder.
+    std::vector<Share> even{Share{1, 10, 0}, Share{1, 10, 0},
+                            Share{1, 10, 0}};
+    EXPECT_EQ(0, detail::share_space(even, 5));
+    EXPECT_EQ(2, even[0].amount);
+    EXPECT_EQ(2, even[1].amount);
+    EXPECT_EQ(1, even[2].amount);
+
+    // More space than capacity is returned.
+    EXPECT_EQ(10, detail::share_space(even, 40));
+}
+
+TEST(Layout, ExpandingChildrenSplitByStretch) {
+    discard_events();
+    layout::Vertical layout;
+    auto& a = layout.make_child<Widget>();
+    auto& b = layout.make_child<Widget>();
+    auto& c = layout.make_child<Widget>();
+    a.height_policy.stretch(1);
+    b.height_policy.stretch(1);
+    c.height_policy.stretch(1);
+    layout.enable();
+    System::send_event(Resize_event{layout, Area{4, 10}});
+    process_events();
+    EXPECT_EQ(10, a.height() + b.height() + c.height());
+    EXPECT_EQ(4, a.height());
+    EXPECT_EQ(3, b.height());
+    EXPECT_EQ(3, c.height());
+}
+
+TEST(Layout, BatchPostsOneNotification) {
+    discard_events();
+    layout::Vertical layout;
+    auto& top = layout.make_child<Probe>();
+    auto& bottom = layout.make_child<Probe>();
+    layout.enable();
+    System::send_event(Resize_event{layout, Area{10, 10}});
+    process_events();
+    {
+        Layout_batch batch{layout};
+        top.height_policy.fixed(2);
+        bottom.height_policy.preferred(3);
+        bottom.height_policy.stretch(2);
+        {
+            Layout_batch inner{layout};
+            top.height_policy.hint(4);
+        }
+        EXPECT_EQ(0, count_polished());
+    }
+    EXPECT_EQ(1, count_polished());
+    process_events();
+    EXPECT_EQ(4, top.height());
+    EXPECT_EQ(6, bottom.height());
+
+    // Nothing changed, nothing is posted.
+    { Layout_batch batch{layout}; }
+    EXPECT_EQ(0, count_polished());
+}
+
+TEST(Layout, GridPlacesChildrenInCells) {
+    discard_events();
+    layout::Grid grid{3};
+    std::vector<Probe*> cells;
+    for (int i{0}; i < 6; ++i) {
+        cells.push_back(&grid.make_child<Probe>());
+    }
+    cells[0]->width_policy.fixed(2);
+    cells[4]->height_policy.fixed(1);
+    grid.enable();
+    System::send_event(Resize_event{grid, Area{12, 6}});
+    process_events();
+    EXPECT_EQ(2, grid.rows());
+
+    // Ignored tracks start at their share of stretch, Preferred at the hint,
+    // and the space left is shared between them.
+    EXPECT_EQ(2, cells[0]->width());
+    EXPECT_EQ(3, cells[1]->x());
+    EXPECT_EQ(8, cells[2]->x());
+    EXPECT_EQ(3, cells[3]->width());
+    EXPECT_EQ(4, cells[3]->y());
+    EXPECT_EQ(1, cells[4]->height());
+    EXPECT_EQ(2, cells[5]->height());
+
+    // Only the cells whose geometry changes get events.
+    for (Probe* cell : cells) {
+        cell->moves = cell->resizes = 0;
+    }
+    System::send_event(Resize_event{grid, Area{12, 8}});
+    process_events();
+    EXPECT_EQ(6, cells[1]->height());
+    EXPECT_EQ(6, cells[3]->y());
+    EXPECT_EQ(0, cells[0]->moves);
+    EXPECT_EQ(1, cells[3]->moves);
+    EXPECT_EQ(0, cells[4]->resizes);
+}
@@ -0,0 +1,108 @@
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cppurses/painter/detail/screen_descriptor.hpp>
+#include <cppurses/painter/detail/staged_changes.hpp>
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/system/events/paint_event.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/widgets/list.hpp>
+#include <cppurses/widget/widgets/list_source.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+/// Row i is "row i" and "i * 2", counts the rows requested.
+class Numbers : public List_source {
+   public:
+    explicit Numbers(std::size_t size) : size_{size} {}
+
+    std::size_t size() const override { return size_; }
+
+    void row(std::size_t index,
+             std::vector<Glyph_string>& cells) const override {
+        ++requested;
+        cells.emplace_back("row " + std::to_string(index));
+        cells.emplace_back(std::to_string(index * 2));
+    }
+
+    mutable std::size_t requested{0};
+
+   private:
+    std::size_t size_;
+};
+
+/// List sized to 16x4.
+class Small_list : public List {
+   public:
+    explicit Small_list(const List_source& source) : List{source} {
+        this->enable();
+        System::send_event(Resize_event{*this, Area{16, 4}});
+    }
+};
+
+/// Paint \p list and return line \p y of it, blanks as spaces.
+std::string painted_line(List& list, std::size_t y) {
+    detail::Staged_changes::get().clear();
+    System::send_event(Paint_event{list});
+    const auto& screen = detail::Staged_changes::get()[&list];
+    auto line = std::string(list.width(), ' ');
+    for (std::size_t x{0}; x < list.width(); ++x) {
+        const auto at = screen.find(Point{x, y});
+        if (at != screen.end()) {
+            line[x] = static_cast<char>(at->second.symbol);
+        }
+    }
+    return line;
+}
+
+}  // namespace
+
+TEST(List, PaintsOnlyVisibleRows) {
+    const Numbers numbers{10000000};
+    Small_list list{numbers};
+    list.add_column(Glyph_string{"Name"}, 10);
+    list.add_column(Glyph_string{"Double"}, 6);
+    EXPECT_EQ(3, list.visible_rows());
+
+    numbers.requested = 0;
+    EXPECT_EQ("Name      Double", painted_line(list, 0));
+    EXPECT_EQ(3, numbers.requested);
+
+    list.select(static_cast<std::size_t>(-1));
+    EXPECT_EQ(9999999, list.selected_index());
+    EXPECT_EQ(9999997, list.top_index());
+    numbers.requested = 0;
+    EXPECT_EQ("row 99999 199999", painted_line(list, 3));
+    EXPECT_EQ(3, numbers.requested);
+}
+
+TEST(List, SelectionScrollsIntoView) {
+    const Numbers numbers{100};
+    Small_list list{numbers};
+    auto changes = std::size_t{0};
+    list.selection_changed.connect([&changes](std::size_t) { ++changes; });
+
+    list.select_down(5);
+    EXPECT_EQ(5, list.selected_index());
+    EXPECT_EQ(2, list.top_index());
+    EXPECT_EQ("row 5           ", painted_line(list, 3));
+    list.select_up(10);
+    EXPECT_EQ(0, list.selected_index());
+    EXPECT_EQ(0, list.top_index());
+    EXPECT_EQ(2, changes);
+
+    // Scrolling moves the view only, and stops with the last row in view.
+    list.scroll_down(1000);
+    EXPECT_EQ(96, list.top_index());
+    EXPECT_EQ(0, list.selected_index());
+    list.select_up(1);
+    EXPECT_EQ(2, changes);
+}
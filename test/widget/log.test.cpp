@@ -0,0 +1,104 @@
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/widgets/log.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+/// Log sized to 6x4, word wrapping messages longer than its width.
+class Small_log : public Log {
+   public:
+    Small_log() {
+        this->enable();
+        System::send_event(Resize_event{*this, Area{6, 4}});
+    }
+
+    using Log::set_contents;
+
+    auto line_starts() const -> std::vector<std::size_t> {
+        auto result = std::vector<std::size_t>{};
+        for (auto i = std::size_t{0}; i < this->line_count(); ++i) {
+            result.push_back(this->first_index_at(i));
+        }
+        return result;
+    }
+};
+
+}  // namespace
+
+TEST(Log, EvictsOldestMessagesPastMaxMessages) {
+    Small_log log;
+    log.set_max_messages(3);
+    for (auto i = 0; i < 10; ++i) {
+        log.post_message(Glyph_string{"msg " + std::to_string(i) + " long"});
+    }
+    EXPECT_EQ("msg 7 long\nmsg 8 long\nmsg 9 long", log.contents().str());
+    // Evicting without a reflow gives the same layout as a full reflow.
+    Small_log fresh;
+    fresh.set_contents(log.contents());
+    EXPECT_EQ(fresh.line_starts(), log.line_starts());
+    EXPECT_EQ(6, log.line_starts().size());
+}
+
+TEST(Log, EvictsOldestMessagesPastMaxBytes) {
+    Small_log log;
+    for (auto i = 0; i < 5; ++i) {
+        log.post_message(Glyph_string{"abcd"});
+    }
+    log.set_max_bytes(12 * sizeof(Glyph));
+    EXPECT_EQ("abcd\nabcd", log.contents().str());
+    // The newest message is always kept.
+    log.set_max_bytes(0);
+    EXPECT_EQ("abcd", log.contents().str());
+    log.clear();
+    log.post_message(Glyph_string{"x"});
+    EXPECT_EQ("x", log.contents().str());
+}
+
+TEST(Log, AsyncMessagesArePostedInOneBatch) {
+    Small_log log;
+    const auto per_thread = 500;
+    auto workers = std::vector<std::thread>{};
+    for (auto t = 0; t < 4; ++t) {
+        workers.emplace_back([&log, t] {
+            const auto source = "worker " + std::to_string(t);
+            for (auto i = 0; i < per_thread; ++i) {
+                log.post_message_async(
+                    Glyph_string{std::to_string(t) + ":" + std::to_string(i)},
+                    source);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    log.flush_async_messages();
+    // Messages from each thread keep their order.
+    auto next = std::vector<int>(4, 0);
+    auto lines = 0;
+    const auto text = log.contents().str() + "\n";
+    for (auto at = std::size_t{0}; at < text.size(); ++lines) {
+        const auto end = text.find('\n', at);
+        const auto colon = text.find(':', at);
+        const auto t = std::stoi(text.substr(at, colon - at));
+        EXPECT_EQ(next[t]++, std::stoi(text.substr(colon + 1, end - colon)));
+        at = end + 1;
+    }
+    EXPECT_EQ(4 * per_thread, lines);
+    ASSERT_EQ(4, log.source_stats().size());
+    EXPECT_EQ(per_thread, log.source_stats().at("worker 2").messages);
+    const auto size = log.contents_size();
+    log.flush_async_messages();
+    EXPECT_EQ(size, log.contents_size());
+}
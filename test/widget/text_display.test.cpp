@@ -0,0 +1,260 @@
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/color.hpp>
+#include <cppurses/painter/detail/screen_descriptor.hpp>
+#include <cppurses/painter/detail/staged_changes.hpp>
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/system/events/paint_event.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/widgets/highlighter.hpp>
+#include <cppurses/widget/widgets/text_display.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+/// Exposes the line layout of a Text_display.
+class Layout_probe : public Text_display {
+   public:
+    explicit Layout_probe(std::size_t width, bool word_wrap) {
+        this->enable_word_wrap(word_wrap);
+        this->enable();
+        System::send_event(Resize_event{*this, Area{width, 10}});
+    }
+
+    auto lines() const -> std::vector<std::pair<std::size_t, std::size_t>> {
+        auto result = std::vector<std::pair<std::size_t, std::size_t>>{};
+        for (auto i = std::size_t{0}; i < this->line_count(); ++i) {
+            result.emplace_back(this->first_index_at(i), this->line_length(i));
+        }
+        return result;
+    }
+};
+
+/// Return the layout a full reflow gives for the contents of \p display.
+auto full_reflow(const Layout_probe& display, std::size_t width, bool wrap)
+    -> std::vector<std::pair<std::size_t, std::size_t>> {
+    Layout_probe fresh{width, wrap};
+    fresh.set_contents(display.contents());
+    return fresh.lines();
+}
+
+}  // namespace
+
+TEST(TextDisplay, IncrementalReflowMatchesFullReflow) {
+    const auto alphabet = Glyph_string{"ab  cd\n efgh ijk\n\n"};
+    auto gen = std::mt19937{7};
+    for (auto wrap : {true, false}) {
+        for (auto width : {std::size_t{1}, std::size_t{4}, std::size_t{9}}) {
+            Layout_probe display{width, wrap};
+            for (auto step = 0; step < 400; ++step) {
+                const auto size = display.contents_size();
+                const auto index =
+                    std::uniform_int_distribution<std::size_t>{0, size}(gen);
+                const auto op = std::uniform_int_distribution<int>{0, 3}(gen);
+                auto text = Glyph_string{};
+                const auto count =
+                    std::uniform_int_distribution<std::size_t>{1, 12}(gen);
+                for (auto i = std::size_t{0}; i < count; ++i) {
+                    text.append(alphabet[std::uniform_int_distribution<
+                        std::size_t>{0, alphabet.size() - 1}(gen)]);
+                }
+                if (op == 0 || size < 20) {
+                    display.insert(text, index);
+                } else if (op == 1) {
+                    display.append(text);
+                } else if (op == 2) {
+                    display.erase(index, count);
+                } else {
+                    display.pop_back();
+                }
+                ASSERT_EQ(full_reflow(display, width, wrap), display.lines())
+                    << "width " << width << ", step " << step;
+            }
+        }
+    }
+}
+
+namespace {
+
+/// Return the start of each occurrence of \p pattern in \p text.
+auto find_all(const std::string& text, const std::string& pattern)
+    -> std::vector<std::size_t> {
+    auto result = std::vector<std::size_t>{};
+    for (auto at = text.find(pattern); at != std::string::npos;
+         at = text.find(pattern, at + 1)) {
+        result.push_back(at);
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(TextDisplay, MatchesFollowEdits) {
+    const auto alphabet = Glyph_string{"abab a\nb"};
+    auto gen = std::mt19937{9};
+    Layout_probe display{7, true};
+    display.find(Glyph_string{"aba"});
+    for (auto step = 0; step < 400; ++step) {
+        const auto size = display.contents_size();
+        const auto index =
+            std::uniform_int_distribution<std::size_t>{0, size}(gen);
+        auto text = Glyph_string{};
+        const auto count =
+            std::uniform_int_distribution<std::size_t>{1, 6}(gen);
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            text.append(alphabet[std::uniform_int_distribution<std::size_t>{
+                0, alphabet.size() - 1}(gen)]);
+        }
+        if (size < 30 || step % 2 == 0) {
+            display.insert(text, index);
+        } else {
+            display.erase(index, count);
+        }
+        ASSERT_EQ(find_all(display.contents().str(), "aba"), display.matches())
+            << "step " << step;
+    }
+    // Extending the pattern narrows the existing matches.
+    display.find(Glyph_string{"abab"});
+    EXPECT_EQ(find_all(display.contents().str(), "abab"), display.matches());
+}
+
+TEST(TextDisplay, FindNextWrapsAround) {
+    Layout_probe display{10, true};
+    display.set_contents(Glyph_string{"x.x..x"});
+    EXPECT_FALSE(display.find_next());
+    display.find(Glyph_string{"x"});
+    ASSERT_EQ(3, display.matches().size());
+    EXPECT_TRUE(display.find_next());
+    EXPECT_EQ(0, display.selected_match());
+    display.find_next();
+    display.find_next();
+    EXPECT_EQ(5, display.selected_match());
+    display.find_next();
+    EXPECT_EQ(0, display.selected_match());
+    display.find_previous();
+    EXPECT_EQ(5, display.selected_match());
+    display.find(Glyph_string{});
+    EXPECT_TRUE(display.matches().empty());
+}
+
+namespace {
+
+/// Colors block comments, counts the lines it is asked to highlight.
+class Comment_highlighter : public Highlighter {
+   public:
+    explicit Comment_highlighter(std::size_t& calls) : calls_{calls} {}
+
+    State highlight(const std::wstring& line,
+                    State state,
+                    std::vector<Span>& spans) const override {
+        ++calls_;
+        auto begin = std::size_t{0};
+        for (auto i = std::size_t{0}; i < line.size(); ++i) {
+            if (state == 0 && line.compare(i, 2, L"/*") == 0) {
+                state = 1;
+                begin = i++;
+            } else if (state == 1 && line.compare(i, 2, L"*/") == 0) {
+                state = 0;
+                spans.push_back(Span{begin, ++i + 1 - begin, comment});
+            }
+        }
+        if (state == 1) {
+            spans.push_back(Span{begin, line.size() - begin, comment});
+        }
+        return state;
+    }
+
+    const Brush comment{foreground(Color::Green)};
+
+   private:
+    std::size_t& calls_;
+};
+
+/// Paint \p display and return the Glyphs it put on the screen.
+auto painted(Text_display& display) -> detail::Screen_descriptor {
+    detail::Staged_changes::get().clear();
+    System::send_event(Paint_event{display});
+    return detail::Staged_changes::get()[&display];
+}
+
+/// Return true if the Glyph at (\p x, \p y) of \p screen is in a comment.
+bool commented(const detail::Screen_descriptor& screen,
+               std::size_t x,
+               std::size_t y) {
+    const auto color = screen.at(Point{x, y}).brush.foreground_color();
+    return color && *color == Color::Green;
+}
+
+}  // namespace
+
+TEST(TextDisplay, HighlighterRestylesUntilStateResynchronizes) {
+    auto calls = std::size_t{0};
+    Layout_probe display{20, true};
+    display.set_contents(Glyph_string{"a\nb\nc\nd\ne\nf\ng\nh"});
+    display.set_highlighter(std::make_unique<Comment_highlighter>(calls));
+    painted(display);
+    EXPECT_EQ(8, calls);
+
+    // Opening a comment restyles every line after it.
+    calls = 0;
+    display.insert(Glyph_string{"/*"}, 2);
+    auto screen = painted(display);
+    EXPECT_EQ(7, calls);
+    EXPECT_TRUE(commented(screen, 0, 6));
+    EXPECT_FALSE(commented(screen, 0, 0));
+
+    // An edit within the comment leaves the State after it unchanged.
+    calls = 0;
+    display.insert(Glyph_string{"x"}, 11);
+    screen = painted(display);
+    EXPECT_EQ(1, calls);
+    EXPECT_TRUE(commented(screen, 0, 7));
+
+    // Closing it restyles the lines up to the end of the text.
+    calls = 0;
+    display.insert(Glyph_string{"*/"}, 7);
+    screen = painted(display);
+    EXPECT_EQ(6, calls);
+    EXPECT_TRUE(commented(screen, 2, 2));
+    EXPECT_FALSE(commented(screen, 0, 3));
+}
+
+TEST(TextDisplay, HighlighterMatchesFreshStyling) {
+    const auto alphabet = Glyph_string{"ab /*\n*/ "};
+    auto gen = std::mt19937{11};
+    auto calls = std::size_t{0};
+    Layout_probe display{6, true};
+    display.set_highlighter(std::make_unique<Comment_highlighter>(calls));
+    for (auto step = 0; step < 300; ++step) {
+        const auto size = display.contents_size();
+        const auto index =
+            std::uniform_int_distribution<std::size_t>{0, size}(gen);
+        auto text = Glyph_string{};
+        const auto count =
+            std::uniform_int_distribution<std::size_t>{1, 4}(gen);
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            text.append(alphabet[std::uniform_int_distribution<std::size_t>{
+                0, alphabet.size() - 1}(gen)]);
+        }
+        if (size < 40 || step % 2 == 0) {
+            display.insert(text, index);
+        } else {
+            display.erase(index, count);
+        }
+        Layout_probe fresh{6, true};
+        fresh.set_highlighter(std::make_unique<Comment_highlighter>(calls));
+        fresh.set_contents(display.contents());
+        ASSERT_EQ(painted(fresh), painted(display)) << "step " << step;
+    }
+}
@@ -0,0 +1,78 @@
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cppurses/system/detail/event_engine.hpp>
+#include <cppurses/system/detail/event_queue.hpp>
+#include <cppurses/system/event.hpp>
+#include <cppurses/system/events/focus_event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/detail/widget_registry.hpp>
+#include <cppurses/widget/widget.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+/// Remove every queued event, returning how many there were.
+std::size_t take_events() {
+    auto& queue = detail::Event_engine::get().queue();
+    std::size_t count{0};
+    for (std::unique_ptr<Event> event :
+         detail::Event_queue::View<Event::None>{queue}) {
+        ++count;
+    }
+    queue.clean();
+    return count;
+}
+
+}  // namespace
+
+TEST(WidgetRegistry, FindsLivingWidgetsOnly) {
+    auto w = std::make_unique<Widget>();
+    const std::uint64_t id = w->unique_id();
+    EXPECT_EQ(w.get(), detail::Widget_registry::find(id));
+    w.reset();
+    EXPECT_EQ(nullptr, detail::Widget_registry::find(id));
+
+    // The ID of a destroyed Widget is never handed out again.
+    Widget next;
+    EXPECT_NE(id, next.unique_id());
+    EXPECT_EQ(nullptr, detail::Widget_registry::find(id));
+}
+
+TEST(WidgetRegistry, PostEventToDropsDeadIds) {
+    take_events();
+    auto w = std::make_unique<Widget>();
+    const std::uint64_t id = w->unique_id();
+    EXPECT_TRUE(System::post_event_to<Focus_in_event>(id));
+    EXPECT_EQ(1, take_events());
+    w.reset();
+    EXPECT_FALSE(System::post_event_to<Focus_in_event>(id));
+    EXPECT_EQ(0, take_events());
+}
+
+TEST(WidgetRegistry, IdsAreUniqueAcrossThreads) {
+    constexpr std::size_t per_thread{2000};
+    std::vector<std::vector<std::uint64_t>> ids(4);
+    std::vector<std::thread> threads;
+    for (auto& thread_ids : ids) {
+        threads.emplace_back([&thread_ids] {
+            for (std::size_t i{0}; i < per_thread; ++i) {
+                thread_ids.push_back(detail::Widget_registry::next_id());
+            }
+        });
+    }
+    for (std::thread& t : threads) {
+        t.join();
+    }
+    std::set<std::uint64_t> unique;
+    for (const auto& thread_ids : ids) {
+        unique.insert(thread_ids.begin(), thread_ids.end());
+    }
+    EXPECT_EQ(ids.size() * per_thread, unique.size());
+}